@@ -592,6 +592,10 @@ uint64_t OS::get_static_memory_peak_usage() const {
 	return ::OS::get_singleton()->get_static_memory_peak_usage();
 }
 
+double OS::get_static_memory_fragmentation() const {
+	return ::OS::get_singleton()->get_static_memory_fragmentation();
+}
+
 Dictionary OS::get_memory_info() const {
 	return ::OS::get_singleton()->get_memory_info();
 }
@@ -815,6 +819,7 @@ void OS::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_static_memory_usage"), &OS::get_static_memory_usage);
 	ClassDB::bind_method(D_METHOD("get_static_memory_peak_usage"), &OS::get_static_memory_peak_usage);
+	ClassDB::bind_method(D_METHOD("get_static_memory_fragmentation"), &OS::get_static_memory_fragmentation);
 	ClassDB::bind_method(D_METHOD("get_memory_info"), &OS::get_memory_info);
 
 	ClassDB::bind_method(D_METHOD("move_to_trash", "path"), &OS::move_to_trash);
@@ -263,6 +263,7 @@ public:
 
 	uint64_t get_static_memory_usage() const;
 	uint64_t get_static_memory_peak_usage() const;
+	double get_static_memory_fragmentation() const;
 	Dictionary get_memory_info() const;
 
 	void delay_usec(int p_usec) const;
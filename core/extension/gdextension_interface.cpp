@@ -1261,6 +1261,70 @@ static GDExtensionTypePtr gdextension_packed_vector4_array_operator_index_const(
 	return (GDExtensionTypePtr)&self->ptr()[p_index];
 }
 
+template <typename T>
+static const void *_packed_array_get_read_span(GDExtensionConstTypePtr p_self, GDExtensionInt *r_size) {
+	const Vector<T> *self = (const Vector<T> *)p_self;
+	*r_size = self->size();
+	return self->ptr();
+}
+
+template <typename T>
+static void *_packed_array_get_write_span(GDExtensionTypePtr p_self, GDExtensionInt *r_size) {
+	Vector<T> *self = (Vector<T> *)p_self;
+	*r_size = self->size();
+	return self->ptrw();
+}
+
+template <typename T>
+static void _packed_array_move(GDExtensionUninitializedTypePtr r_dest, GDExtensionTypePtr p_src) {
+	memnew_placement(r_dest, Vector<T>(std::move(*(Vector<T> *)p_src)));
+}
+
+#define PACKED_ARRAY_DISPATCH(m_type, m_func, ...)                                \
+	switch (m_type) {                                                             \
+		case GDEXTENSION_VARIANT_TYPE_PACKED_BYTE_ARRAY:                          \
+			return m_func<uint8_t>(__VA_ARGS__);                                  \
+		case GDEXTENSION_VARIANT_TYPE_PACKED_INT32_ARRAY:                         \
+			return m_func<int32_t>(__VA_ARGS__);                                  \
+		case GDEXTENSION_VARIANT_TYPE_PACKED_INT64_ARRAY:                         \
+			return m_func<int64_t>(__VA_ARGS__);                                  \
+		case GDEXTENSION_VARIANT_TYPE_PACKED_FLOAT32_ARRAY:                       \
+			return m_func<float>(__VA_ARGS__);                                    \
+		case GDEXTENSION_VARIANT_TYPE_PACKED_FLOAT64_ARRAY:                       \
+			return m_func<double>(__VA_ARGS__);                                   \
+		case GDEXTENSION_VARIANT_TYPE_PACKED_STRING_ARRAY:                        \
+			return m_func<String>(__VA_ARGS__);                                   \
+		case GDEXTENSION_VARIANT_TYPE_PACKED_VECTOR2_ARRAY:                       \
+			return m_func<Vector2>(__VA_ARGS__);                                  \
+		case GDEXTENSION_VARIANT_TYPE_PACKED_VECTOR3_ARRAY:                       \
+			return m_func<Vector3>(__VA_ARGS__);                                  \
+		case GDEXTENSION_VARIANT_TYPE_PACKED_COLOR_ARRAY:                         \
+			return m_func<Color>(__VA_ARGS__);                                    \
+		case GDEXTENSION_VARIANT_TYPE_PACKED_VECTOR4_ARRAY:                       \
+			return m_func<Vector4>(__VA_ARGS__);                                  \
+		default:                                                                  \
+			break;                                                                \
+	}
+
+static const void *gdextension_packed_array_get_read_span(GDExtensionVariantType p_type, GDExtensionConstTypePtr p_self, GDExtensionInt *r_size) {
+	PACKED_ARRAY_DISPATCH(p_type, _packed_array_get_read_span, p_self, r_size);
+	*r_size = 0;
+	ERR_FAIL_V_MSG(nullptr, "The type is not a packed array type.");
+}
+
+static void *gdextension_packed_array_get_write_span(GDExtensionVariantType p_type, GDExtensionTypePtr p_self, GDExtensionInt *r_size) {
+	PACKED_ARRAY_DISPATCH(p_type, _packed_array_get_write_span, p_self, r_size);
+	*r_size = 0;
+	ERR_FAIL_V_MSG(nullptr, "The type is not a packed array type.");
+}
+
+static void gdextension_packed_array_move(GDExtensionVariantType p_type, GDExtensionUninitializedTypePtr r_dest, GDExtensionTypePtr p_src) {
+	PACKED_ARRAY_DISPATCH(p_type, _packed_array_move, r_dest, p_src);
+	ERR_FAIL_MSG("The type is not a packed array type.");
+}
+
+#undef PACKED_ARRAY_DISPATCH
+
 static GDExtensionVariantPtr gdextension_array_operator_index(GDExtensionTypePtr p_self, GDExtensionInt p_index) {
 	Array *self = (Array *)p_self;
 	if (unlikely(p_index < 0 || p_index >= self->size())) {
@@ -1798,6 +1862,9 @@ void gdextension_setup_interface() {
 	REGISTER_INTERFACE_FUNC(packed_vector3_array_operator_index_const);
 	REGISTER_INTERFACE_FUNC(packed_vector4_array_operator_index);
 	REGISTER_INTERFACE_FUNC(packed_vector4_array_operator_index_const);
+	REGISTER_INTERFACE_FUNC(packed_array_get_read_span);
+	REGISTER_INTERFACE_FUNC(packed_array_get_write_span);
+	REGISTER_INTERFACE_FUNC(packed_array_move);
 	REGISTER_INTERFACE_FUNC(array_operator_index);
 	REGISTER_INTERFACE_FUNC(array_operator_index_const);
 #ifndef DISABLE_DEPRECATED
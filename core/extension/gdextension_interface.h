@@ -2385,6 +2385,55 @@ typedef GDExtensionTypePtr (*GDExtensionInterfacePackedColorArrayOperatorIndex)(
  */
 typedef GDExtensionTypePtr (*GDExtensionInterfacePackedColorArrayOperatorIndexConst)(GDExtensionConstTypePtr p_self, GDExtensionInt p_index);
 
+/**
+ * @name packed_array_get_read_span
+ * @since 4.5
+ *
+ * Borrows the contents of a packed array for reading, without copying them.
+ *
+ * The span stays valid until the array is modified or destroyed. Unlike getting a pointer
+ * with the non-const operator_index functions, this never duplicates data shared with other arrays.
+ *
+ * @param p_type The type of the packed array (one of the GDEXTENSION_VARIANT_TYPE_PACKED_* types).
+ * @param p_self A const pointer to the packed array.
+ * @param r_size A pointer to an integer that will receive the number of elements.
+ *
+ * @return A const pointer to the first element, or NULL if the array is empty or the type is not a packed array type.
+ */
+typedef const void *(*GDExtensionInterfacePackedArrayGetReadSpan)(GDExtensionVariantType p_type, GDExtensionConstTypePtr p_self, GDExtensionInt *r_size);
+
+/**
+ * @name packed_array_get_write_span
+ * @since 4.5
+ *
+ * Gets the contents of a packed array for writing.
+ *
+ * If the data is shared with other arrays, it is duplicated once here, so that the array owns it exclusively.
+ * The span stays valid until the array is resized, assigned, copied or destroyed.
+ *
+ * @param p_type The type of the packed array (one of the GDEXTENSION_VARIANT_TYPE_PACKED_* types).
+ * @param p_self A pointer to the packed array.
+ * @param r_size A pointer to an integer that will receive the number of elements.
+ *
+ * @return A pointer to the first element, or NULL if the array is empty or the type is not a packed array type.
+ */
+typedef void *(*GDExtensionInterfacePackedArrayGetWriteSpan)(GDExtensionVariantType p_type, GDExtensionTypePtr p_self, GDExtensionInt *r_size);
+
+/**
+ * @name packed_array_move
+ * @since 4.5
+ *
+ * Moves the contents of a packed array into a new one, leaving the source array empty.
+ *
+ * No data is copied. If the source array was the only one referencing its data, the destination
+ * owns it exclusively afterwards, so writing to it does not duplicate the data.
+ *
+ * @param p_type The type of the packed arrays (one of the GDEXTENSION_VARIANT_TYPE_PACKED_* types).
+ * @param r_dest A pointer to the uninitialized packed array to move into.
+ * @param p_src A pointer to the packed array to move from.
+ */
+typedef void (*GDExtensionInterfacePackedArrayMove)(GDExtensionVariantType p_type, GDExtensionUninitializedTypePtr r_dest, GDExtensionTypePtr p_src);
+
 /**
  * @name array_operator_index
  * @since 4.1
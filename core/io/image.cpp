@@ -35,6 +35,7 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
 
@@ -783,6 +784,11 @@ static double _bicubic_interp_kernel(double x) {
 	return bc;
 }
 
+// Rows are cheap to process on their own, so keep a few thousand pixels per parallel chunk.
+static _FORCE_INLINE_ uint32_t _get_parallel_row_grain(uint32_t p_row_width) {
+	return MAX(8192u / MAX(p_row_width, 1u), 1u);
+}
+
 template <int CC, typename T>
 static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
 	// get source image size
@@ -790,26 +796,23 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int height = p_src_height;
 	double xfac = (double)width / p_dst_width;
 	double yfac = (double)height / p_dst_height;
-	// coordinates of source points and coefficients
-	double ox, oy, dx, dy;
-	int ox1, oy1, ox2, oy2;
 	// destination pixel values
 	// width and height decreased by 1
 	int ymax = height - 1;
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
+	WorkerThreadPool::parallel_for(0, p_dst_height, _get_parallel_row_grain(p_dst_width), [&](uint32_t y) {
 		// Y coordinates
-		oy = (double)(y + 0.5) * yfac - 0.5;
-		oy1 = (int)oy;
-		dy = oy - (double)oy1;
+		double oy = (double)(y + 0.5) * yfac - 0.5;
+		int oy1 = (int)oy;
+		double dy = oy - (double)oy1;
 
 		for (uint32_t x = 0; x < p_dst_width; x++) {
 			// X coordinates
-			ox = (double)(x + 0.5) * xfac - 0.5;
-			ox1 = (int)ox;
-			dx = ox - (double)ox1;
+			double ox = (double)(x + 0.5) * xfac - 0.5;
+			int ox1 = (int)ox;
+			double dx = ox - (double)ox1;
 
 			// initial pixel value
 
@@ -821,7 +824,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 				// get Y coefficient
 				[[maybe_unused]] double k1 = _bicubic_interp_kernel(dy - (double)n);
 
-				oy2 = oy1 + n;
+				int oy2 = oy1 + n;
 				if (oy2 < 0) {
 					oy2 = 0;
 				}
@@ -833,7 +836,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 					// get X coefficient
 					[[maybe_unused]] double k2 = k1 * _bicubic_interp_kernel((double)m - dx);
 
-					ox2 = ox1 + m;
+					int ox2 = ox1 + m;
 					if (ox2 < 0) {
 						ox2 = 0;
 					}
@@ -864,7 +867,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, typename T>
@@ -874,7 +877,7 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 	constexpr uint32_t FRAC_HALF = (FRAC_LEN >> 1);
 	constexpr uint32_t FRAC_MASK = FRAC_LEN - 1;
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	WorkerThreadPool::parallel_for(0, p_dst_height, _get_parallel_row_grain(p_dst_width), [&](uint32_t i) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
 		// Calculate nearest src pixel center above current, and truncate to get y index
@@ -952,12 +955,12 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, typename T>
 static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	WorkerThreadPool::parallel_for(0, p_dst_height, _get_parallel_row_grain(p_dst_width), [&](uint32_t i) {
 		uint32_t src_yofs = (i + 0.5) * p_src_height / p_dst_height;
 		uint32_t y_ofs = src_yofs * p_src_width * CC;
 
@@ -973,7 +976,7 @@ static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict
 				dst[i * p_dst_width * CC + j * CC + l] = p;
 			}
 		}
-	}
+	});
 }
 
 #define LANCZOS_TYPE 3
@@ -999,47 +1002,50 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		// Columns are independent, so they are processed in parallel, with a kernel per chunk.
+		WorkerThreadPool::parallel_for_range(0, dst_width, _get_parallel_row_grain(src_height), [&](uint32_t p_from, uint32_t p_to) {
+			float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
-			// The corresponding point on the source image
-			float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
-			int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
-			int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
+			for (int32_t buffer_x = p_from; buffer_x < (int32_t)p_to; buffer_x++) {
+				// The corresponding point on the source image
+				float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
+				int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
+				int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
 
-			// Create the kernel used by all the pixels of the column
-			for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-				kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
-			}
+				// Create the kernel used by all the pixels of the column
+				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+					kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
+				}
 
-			for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-					float lanczos_val = kernel[target_x - start_x];
-					weight += lanczos_val;
+					for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+						float lanczos_val = kernel[target_x - start_x];
+						weight += lanczos_val;
 
-					const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
+						const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2) { //half float
-							pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
-						} else {
-							pixel[i] += src_data[i] * lanczos_val;
+						for (uint32_t i = 0; i < CC; i++) {
+							if constexpr (sizeof(T) == 2) { //half float
+								pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
+							} else {
+								pixel[i] += src_data[i] * lanczos_val;
+							}
 						}
 					}
-				}
 
-				float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
+					float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					for (uint32_t i = 0; i < CC; i++) {
+						dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					}
 				}
 			}
-		}
 
-		memdelete_arr(kernel);
+			memdelete_arr(kernel);
+		});
 	} // End of first pass
 
 	{ // SECOND PASS (vertical + result)
@@ -1049,49 +1055,52 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		float scale_factor = MAX(y_scale, 1);
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		// Rows are independent, so they are processed in parallel, with a kernel per chunk.
+		WorkerThreadPool::parallel_for_range(0, dst_height, _get_parallel_row_grain(dst_width), [&](uint32_t p_from, uint32_t p_to) {
+			float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t dst_y = 0; dst_y < dst_height; dst_y++) {
-			float buffer_y = (dst_y + 0.5f) * y_scale;
-			int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
-			int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
+			for (int32_t dst_y = p_from; dst_y < (int32_t)p_to; dst_y++) {
+				float buffer_y = (dst_y + 0.5f) * y_scale;
+				int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
+				int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
 
-			for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-				kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
-			}
+				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+					kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
+				}
 
-			for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-					float lanczos_val = kernel[target_y - start_y];
-					weight += lanczos_val;
+					for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+						float lanczos_val = kernel[target_y - start_y];
+						weight += lanczos_val;
 
-					float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
+						float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						pixel[i] += buffer_data[i] * lanczos_val;
+						for (uint32_t i = 0; i < CC; i++) {
+							pixel[i] += buffer_data[i] * lanczos_val;
+						}
 					}
-				}
 
-				T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
+					T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					pixel[i] /= weight;
-
-					if constexpr (sizeof(T) == 1) { //byte
-						dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
-					} else if constexpr (sizeof(T) == 2) { //half float
-						dst_data[i] = Math::make_half_float(pixel[i]);
-					} else { // float
-						dst_data[i] = pixel[i];
+					for (uint32_t i = 0; i < CC; i++) {
+						pixel[i] /= weight;
+
+						if constexpr (sizeof(T) == 1) { //byte
+							dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
+						} else if constexpr (sizeof(T) == 2) { //half float
+							dst_data[i] = Math::make_half_float(pixel[i]);
+						} else { // float
+							dst_data[i] = pixel[i];
+						}
 					}
 				}
 			}
-		}
 
-		memdelete_arr(kernel);
+			memdelete_arr(kernel);
+		});
 	} // End of second pass
 
 	memdelete_arr(buffer);
@@ -1770,7 +1779,7 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
+	WorkerThreadPool::parallel_for(0, dst_h, _get_parallel_row_grain(dst_w), [&](uint32_t i) {
 		const Component *rup_ptr = &p_src[i * 2 * down_step];
 		const Component *rdown_ptr = rup_ptr + down_step;
 		Component *dst_ptr = &p_dst[i * dst_w * CC];
@@ -1790,7 +1799,7 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 			rup_ptr += right_step * 2;
 			rdown_ptr += right_step * 2;
 		}
-	}
+	});
 }
 
 void Image::_generate_mipmap_from_format(Image::Format p_format, const uint8_t *p_src, uint8_t *p_dst, uint32_t p_width, uint32_t p_height, bool p_renormalize) {
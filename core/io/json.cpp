@@ -218,14 +218,18 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 			case '"': {
 				index++;
 				String str;
+				// Characters are copied in runs between escape sequences, so most strings are allocated once.
+				int run_start = index;
 				while (true) {
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated string";
 						return ERR_PARSE_ERROR;
 					} else if (p_str[index] == '"') {
+						str.append_utf32(Span(p_str + run_start, index - run_start));
 						index++;
 						break;
 					} else if (p_str[index] == '\\') {
+						str.append_utf32(Span(p_str + run_start, index - run_start));
 						//escaped characters...
 						index++;
 						char32_t next = p_str[index];
@@ -341,12 +345,10 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						}
 
 						str += res;
+						run_start = index + 1;
 
-					} else {
-						if (p_str[index] == '\n') {
-							line++;
-						}
-						str += p_str[index];
+					} else if (p_str[index] == '\n') {
+						line++;
 					}
 					index++;
 				}
@@ -394,7 +396,7 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, HashSet<String> &r_keys, String &r_err_str) {
 	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
 		r_err_str = "JSON structure is too deep";
 		return ERR_OUT_OF_MEMORY;
@@ -402,14 +404,14 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 
 	if (token.type == TK_CURLY_BRACKET_OPEN) {
 		Dictionary d;
-		Error err = _parse_object(d, p_str, index, p_len, line, p_depth + 1, r_err_str);
+		Error err = _parse_object(d, p_str, index, p_len, line, p_depth + 1, r_keys, r_err_str);
 		if (err) {
 			return err;
 		}
 		value = d;
 	} else if (token.type == TK_BRACKET_OPEN) {
 		Array a;
-		Error err = _parse_array(a, p_str, index, p_len, line, p_depth + 1, r_err_str);
+		Error err = _parse_array(a, p_str, index, p_len, line, p_depth + 1, r_keys, r_err_str);
 		if (err) {
 			return err;
 		}
@@ -438,7 +440,7 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 	return OK;
 }
 
-Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, HashSet<String> &r_keys, String &r_err_str) {
 	Token token;
 	bool need_comma = false;
 
@@ -463,7 +465,7 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 		}
 
 		Variant v;
-		err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+		err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_keys, r_err_str);
 		if (err) {
 			return err;
 		}
@@ -476,7 +478,7 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, HashSet<String> &r_keys, String &r_err_str) {
 	bool at_key = true;
 	String key;
 	Token token;
@@ -509,6 +511,13 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 			}
 
 			key = token.value;
+			// Objects in a document usually share their keys, so store each distinct key only once.
+			HashSet<String>::Iterator K = r_keys.find(key);
+			if (K) {
+				key = *K;
+			} else {
+				r_keys.insert(key);
+			}
 			err = _get_token(p_str, index, p_len, token, line, r_err_str);
 			if (err != OK) {
 				return err;
@@ -525,7 +534,7 @@ Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index,
 			}
 
 			Variant v;
-			err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_err_str);
+			err = _parse_value(v, token, p_str, index, p_len, line, p_depth, r_keys, r_err_str);
 			if (err) {
 				return err;
 			}
@@ -550,14 +559,14 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 	int len = p_json.length();
 	Token token;
 	r_err_line = 0;
-	String aux_key;
+	HashSet<String> keys;
 
 	Error err = _get_token(str, idx, len, token, r_err_line, r_err_str);
 	if (err) {
 		return err;
 	}
 
-	err = _parse_value(r_ret, token, str, idx, len, r_err_line, 0, r_err_str);
+	err = _parse_value(r_ret, token, str, idx, len, r_err_line, 0, keys, r_err_str);
 
 	// Check if EOF is reached
 	// or it's a type of the next token.
@@ -53,6 +53,7 @@
 #include "bvh_tree.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
 
 #define BVHTREE_CLASS BVH_Tree<T, NUM_TREES, 2, MAX_ITEMS, USER_PAIR_TEST_FUNCTION, USER_CULL_TEST_FUNCTION, USE_PAIRS, BOUNDS, POINT>
@@ -72,6 +73,13 @@ public:
 		_thread_safe = p_enable;
 	}
 
+	// Allow culling the changed items on the WorkerThreadPool when searching for pairs.
+	// The pair and unpair callbacks are still sent from the calling thread, in the same order.
+	// Only enable this if the user cull check function is safe to call from several threads.
+	void params_set_parallel_pairing(bool p_enable) {
+		_parallel_pairing = p_enable;
+	}
+
 	// these 2 are crucial for fine tuning, and can be applied manually
 	// see the variable declarations for more info.
 	void params_set_node_expansion(real_t p_value) {
@@ -382,6 +390,44 @@ public:
 		return params.result_count_overall;
 	}
 
+	// Several threads can cull with the *_concurrent() functions, each one passing its own r_hits.
+	// The lock is only held for the cull itself, so callers are free to wait on other threads meanwhile.
+	int cull_aabb_concurrent(const BOUNDS &p_aabb, T **p_result_array, int p_result_max, const T *p_tester, LocalVector<uint32_t> &r_hits, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		BVH_LOCKED_FUNCTION
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.tree_collision_mask = p_tree_collision_mask;
+		params.abb.from(p_aabb);
+		params.tester = p_tester;
+
+		tree.cull_aabb_concurrent(params, r_hits, true);
+
+		return params.result_count_overall;
+	}
+
+	int cull_segment_concurrent(const POINT &p_from, const POINT &p_to, T **p_result_array, int p_result_max, const T *p_tester, LocalVector<uint32_t> &r_hits, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		BVH_LOCKED_FUNCTION
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.tester = p_tester;
+		params.tree_collision_mask = p_tree_collision_mask;
+
+		params.segment.from = p_from;
+		params.segment.to = p_to;
+
+		tree.cull_segment_concurrent(params, r_hits, true);
+
+		return params.result_count_overall;
+	}
+
 	int cull_point(const POINT &p_point, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
 		BVH_LOCKED_FUNCTION
 		typename BVHTREE_CLASS::CullParams params;
@@ -436,6 +482,11 @@ private:
 			return;
 		}
 
+		if (USE_PAIRS && _parallel_pairing && changed_items.size() >= PARALLEL_PAIRING_MIN_ITEMS) {
+			_check_for_collisions_parallel(p_full_check);
+			return;
+		}
+
 		typename BVHTREE_CLASS::CullParams params;
 
 		params.result_count_overall = 0;
@@ -479,6 +530,57 @@ private:
 		_reset();
 	}
 
+	// Culling only reads the tree, so it is done for all the changed items at once on the
+	// WorkerThreadPool, each into its own hit list. Leavers and enterers are then processed
+	// in the changed item order, exactly like the serial version, which keeps the pairs and
+	// callbacks reproducible.
+	void _check_for_collisions_parallel(bool p_full_check) {
+		uint32_t changed_count = changed_items.size();
+		if (_pairing_hits.size() < changed_count) {
+			_pairing_hits.resize(changed_count);
+		}
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &BVH_Manager::_cull_changed_item, (void *)nullptr, changed_count, -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		for (uint32_t n = 0; n < changed_count; n++) {
+			const BVHHandle &h = changed_items[n];
+
+			BVHABB_CLASS abb;
+			abb.from(tree._pairs[h.id()].expanded_aabb);
+			_find_leavers(h, abb, p_full_check);
+
+			uint32_t changed_item_ref_id = h.id();
+
+			for (const uint32_t ref_id : _pairing_hits[n]) {
+				if (ref_id == changed_item_ref_id) {
+					continue;
+				}
+
+				BVHHandle h_collidee;
+				h_collidee.set_id(ref_id);
+				_collide(h, h_collidee);
+			}
+		}
+		_reset();
+	}
+
+	void _cull_changed_item(uint32_t p_index, void *p_userdata) {
+		const BVHHandle &h = changed_items[p_index];
+
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+
+		tree.item_fill_cullparams(h, params);
+		params.abb.from(tree._pairs[h.id()].expanded_aabb);
+
+		tree.cull_aabb_concurrent(params, _pairing_hits[p_index]);
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -772,6 +874,13 @@ private:
 	LocalVector<BVHHandle> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	// Pair searches below this many changed items aren't worth dispatching to threads.
+	static constexpr uint32_t PARALLEL_PAIRING_MIN_ITEMS = 128;
+
+	// Hits of every changed item when culling them in parallel, kept to reuse the allocations.
+	LocalVector<LocalVector<uint32_t>> _pairing_hits;
+	bool _parallel_pairing = false;
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
@@ -30,6 +30,7 @@
 
 #include "geometry_3d.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
 
 void Geometry3D::get_closest_points_between_segments(const Vector3 &p_p0, const Vector3 &p_p1, const Vector3 &p_q0, const Vector3 &p_q1, Vector3 &r_ps, Vector3 &r_qt) {
@@ -457,12 +458,15 @@ Vector<Face3> Geometry3D::wrap_geometry(const Vector<Face3> &p_array, real_t *p_
 
 	AABB global_aabb;
 
-	for (int i = 0; i < face_count; i++) {
-		if (i == 0) {
-			global_aabb = faces[i].get_aabb();
-		} else {
-			global_aabb.merge_with(faces[i].get_aabb());
-		}
+	if (face_count > 0) {
+		global_aabb = WorkerThreadPool::parallel_reduce(
+				1, face_count, 4096, faces[0].get_aabb(),
+				[faces](uint32_t p_index, AABB &r_aabb) {
+					r_aabb.merge_with(faces[p_index].get_aabb());
+				},
+				[](const AABB &p_a, const AABB &p_b) {
+					return p_a.merge(p_b);
+				});
 	}
 
 	global_aabb.grow_by(0.01f); // Avoid numerical error.
@@ -930,29 +934,30 @@ Vector<uint32_t> Geometry3D::generate_edf(const Vector<bool> &p_voxels, const Ve
 	}
 
 	//process in each direction
+	//lines along the same axis are independent, so each pass runs in parallel
 
 	//xy->z
 
-	for (int i = 0; i < p_size.x; i++) {
+	WorkerThreadPool::parallel_for(0, p_size.x, 1, [&](uint32_t i) {
 		for (int j = 0; j < p_size.y; j++) {
 			edt(&work_memory[i + j * y_mult], z_mult, p_size.z);
 		}
-	}
+	});
 
 	//xz->y
 
-	for (int i = 0; i < p_size.x; i++) {
+	WorkerThreadPool::parallel_for(0, p_size.x, 1, [&](uint32_t i) {
 		for (int j = 0; j < p_size.z; j++) {
 			edt(&work_memory[i + j * z_mult], y_mult, p_size.y);
 		}
-	}
+	});
 
 	//yz->x
-	for (int i = 0; i < p_size.y; i++) {
+	WorkerThreadPool::parallel_for(0, p_size.y, 1, [&](uint32_t i) {
 		for (int j = 0; j < p_size.z; j++) {
 			edt(&work_memory[i * y_mult + j * z_mult], 1, p_size.x);
 		}
-	}
+	});
 
 	Vector<uint32_t> ret;
 	ret.resize(float_count);
@@ -30,6 +30,7 @@
 
 #include "quick_hull.h"
 
+#include "core/math/vector3_batch.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 
@@ -38,14 +39,7 @@ uint32_t QuickHull::debug_stop_after = 0xFFFFFFFF;
 Error QuickHull::build(const Vector<Vector3> &p_points, Geometry3D::MeshData &r_mesh) {
 	/* CREATE AABB VOLUME */
 
-	AABB aabb;
-	for (int i = 0; i < p_points.size(); i++) {
-		if (i == 0) {
-			aabb.position = p_points[i];
-		} else {
-			aabb.expand_to(p_points[i]);
-		}
-	}
+	AABB aabb = Vector3Batch::get_aabb(p_points.ptr(), p_points.size());
 
 	if (aabb.size == Vector3()) {
 		return ERR_CANT_CREATE;
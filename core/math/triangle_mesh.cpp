@@ -30,6 +30,7 @@
 
 #include "triangle_mesh.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/sort_array.h"
 
 int TriangleMesh::_create_bvh(BVH *p_bvh, BVH **p_bb, int p_from, int p_size, int p_depth, int &r_max_depth, int &r_max_alloc) {
@@ -127,6 +128,25 @@ void TriangleMesh::create(const Vector<Vector3> &p_faces, const Vector<int32_t>
 		Triangle *w = triangles.ptrw();
 		HashMap<Vector3, int> db;
 
+		// Per-face data doesn't depend on other faces, so it can be computed in parallel.
+		WorkerThreadPool::parallel_for(0, fc, 1024, [&](uint32_t i) {
+			Triangle &f = w[i];
+			const Vector3 *v = &r[i * 3];
+
+			bw[i].aabb.position = v[0].snappedf(0.0001);
+			bw[i].aabb.expand_to(v[1].snappedf(0.0001));
+			bw[i].aabb.expand_to(v[2].snappedf(0.0001));
+
+			f.normal = Face3(v[0], v[1], v[2]).get_plane().get_normal();
+			f.surface_index = si ? si[i] : 0;
+
+			bw[i].left = -1;
+			bw[i].right = -1;
+			bw[i].face_index = i;
+			bw[i].center = bw[i].aabb.get_center();
+		});
+
+		// Vertex deduplication stays serial, so indices are assigned in a stable order.
 		for (int i = 0; i < fc; i++) {
 			Triangle &f = w[i];
 			const Vector3 *v = &r[i * 3];
@@ -143,20 +163,7 @@ void TriangleMesh::create(const Vector<Vector3> &p_faces, const Vector<int32_t>
 				}
 
 				f.indices[j] = vidx;
-				if (j == 0) {
-					bw[i].aabb.position = vs;
-				} else {
-					bw[i].aabb.expand_to(vs);
-				}
 			}
-
-			f.normal = Face3(r[i * 3 + 0], r[i * 3 + 1], r[i * 3 + 2]).get_plane().get_normal();
-			f.surface_index = si ? si[i] : 0;
-
-			bw[i].left = -1;
-			bw[i].right = -1;
-			bw[i].face_index = i;
-			bw[i].center = bw[i].aabb.get_center();
 		}
 
 		vertices.resize(db.size());
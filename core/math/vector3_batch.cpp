@@ -0,0 +1,227 @@
+/**************************************************************************/
+/*  vector3_batch.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "vector3_batch.h"
+
+#include "core/math/transform_3d.h"
+
+#if !defined(REAL_T_IS_DOUBLE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define VECTOR3_BATCH_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef VECTOR3_BATCH_SSE2
+
+// _MM_SHUFFLE() with the lanes in memory order.
+#define SHUFFLE_LANES(m_a, m_b, m_i0, m_i1, m_i2, m_i3) _mm_shuffle_ps(m_a, m_b, _MM_SHUFFLE(m_i3, m_i2, m_i1, m_i0))
+
+// Transposes four consecutive Vector3, as loaded in three registers, into x, y and z lanes.
+static _FORCE_INLINE_ void _load4_registers(__m128 p_a, __m128 p_b, __m128 p_c, __m128 &r_x, __m128 &r_y, __m128 &r_z) {
+	// p_a: x0 y0 z0 x1, p_b: y1 z1 x2 y2, p_c: z2 x3 y3 z3.
+	r_x = SHUFFLE_LANES(p_a, SHUFFLE_LANES(p_b, p_c, 2, 2, 1, 1), 0, 3, 0, 2);
+	r_y = SHUFFLE_LANES(SHUFFLE_LANES(p_a, p_b, 1, 1, 0, 0), SHUFFLE_LANES(p_b, p_c, 3, 3, 2, 2), 0, 2, 0, 2);
+	r_z = SHUFFLE_LANES(SHUFFLE_LANES(p_a, p_b, 2, 2, 1, 1), SHUFFLE_LANES(p_c, p_c, 0, 0, 3, 3), 0, 2, 0, 2);
+}
+
+static _FORCE_INLINE_ void _load4(const Vector3 *p_src, __m128 &r_x, __m128 &r_y, __m128 &r_z) {
+	const float *src = reinterpret_cast<const float *>(p_src);
+	_load4_registers(_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8), r_x, r_y, r_z);
+}
+
+// Inverse of _load4().
+static _FORCE_INLINE_ void _store4(Vector3 *p_dst, __m128 p_x, __m128 p_y, __m128 p_z) {
+	float *dst = reinterpret_cast<float *>(p_dst);
+	_mm_storeu_ps(dst, SHUFFLE_LANES(SHUFFLE_LANES(p_x, p_y, 0, 0, 0, 0), SHUFFLE_LANES(p_z, p_x, 0, 0, 1, 1), 0, 2, 0, 2));
+	_mm_storeu_ps(dst + 4, SHUFFLE_LANES(SHUFFLE_LANES(p_y, p_z, 1, 1, 1, 1), SHUFFLE_LANES(p_x, p_y, 2, 2, 2, 2), 0, 2, 0, 2));
+	_mm_storeu_ps(dst + 8, SHUFFLE_LANES(SHUFFLE_LANES(p_z, p_x, 2, 2, 3, 3), SHUFFLE_LANES(p_y, p_z, 3, 3, 3, 3), 0, 2, 0, 2));
+}
+
+// Same evaluation order as Vector3::dot(), so results match the scalar path.
+static _FORCE_INLINE_ __m128 _dot(__m128 p_ax, __m128 p_ay, __m128 p_az, __m128 p_bx, __m128 p_by, __m128 p_bz) {
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(p_ax, p_bx), _mm_mul_ps(p_ay, p_by)), _mm_mul_ps(p_az, p_bz));
+}
+
+#endif // VECTOR3_BATCH_SSE2
+
+namespace Vector3Batch {
+
+void transform(const Transform3D &p_xform, const Vector3 *p_src, Vector3 *p_dst, int64_t p_count) {
+	int64_t i = 0;
+#ifdef VECTOR3_BATCH_SSE2
+	const Basis &b = p_xform.basis;
+	const __m128 m00 = _mm_set1_ps(b.rows[0].x), m01 = _mm_set1_ps(b.rows[0].y), m02 = _mm_set1_ps(b.rows[0].z);
+	const __m128 m10 = _mm_set1_ps(b.rows[1].x), m11 = _mm_set1_ps(b.rows[1].y), m12 = _mm_set1_ps(b.rows[1].z);
+	const __m128 m20 = _mm_set1_ps(b.rows[2].x), m21 = _mm_set1_ps(b.rows[2].y), m22 = _mm_set1_ps(b.rows[2].z);
+	const __m128 ox = _mm_set1_ps(p_xform.origin.x), oy = _mm_set1_ps(p_xform.origin.y), oz = _mm_set1_ps(p_xform.origin.z);
+
+	for (; i + 4 <= p_count; i += 4) {
+		__m128 x, y, z;
+		_load4(p_src + i, x, y, z);
+		_store4(p_dst + i,
+				_mm_add_ps(_dot(m00, m01, m02, x, y, z), ox),
+				_mm_add_ps(_dot(m10, m11, m12, x, y, z), oy),
+				_mm_add_ps(_dot(m20, m21, m22, x, y, z), oz));
+	}
+#endif
+	for (; i < p_count; i++) {
+		p_dst[i] = p_xform.xform(p_src[i]);
+	}
+}
+
+void transform(const Basis &p_basis, const Vector3 *p_src, Vector3 *p_dst, int64_t p_count) {
+	int64_t i = 0;
+#ifdef VECTOR3_BATCH_SSE2
+	const __m128 m00 = _mm_set1_ps(p_basis.rows[0].x), m01 = _mm_set1_ps(p_basis.rows[0].y), m02 = _mm_set1_ps(p_basis.rows[0].z);
+	const __m128 m10 = _mm_set1_ps(p_basis.rows[1].x), m11 = _mm_set1_ps(p_basis.rows[1].y), m12 = _mm_set1_ps(p_basis.rows[1].z);
+	const __m128 m20 = _mm_set1_ps(p_basis.rows[2].x), m21 = _mm_set1_ps(p_basis.rows[2].y), m22 = _mm_set1_ps(p_basis.rows[2].z);
+
+	for (; i + 4 <= p_count; i += 4) {
+		__m128 x, y, z;
+		_load4(p_src + i, x, y, z);
+		_store4(p_dst + i, _dot(m00, m01, m02, x, y, z), _dot(m10, m11, m12, x, y, z), _dot(m20, m21, m22, x, y, z));
+	}
+#endif
+	for (; i < p_count; i++) {
+		p_dst[i] = p_basis.xform(p_src[i]);
+	}
+}
+
+void normalize(const Vector3 *p_src, Vector3 *p_dst, int64_t p_count) {
+	int64_t i = 0;
+#ifdef VECTOR3_BATCH_SSE2
+	const __m128 zero = _mm_setzero_ps();
+	for (; i + 4 <= p_count; i += 4) {
+		__m128 x, y, z;
+		_load4(p_src + i, x, y, z);
+		const __m128 lengthsq = _dot(x, y, z, x, y, z);
+		// Zero length vectors stay zero, like in Vector3::normalize().
+		const __m128 nonzero = _mm_cmpneq_ps(lengthsq, zero);
+		const __m128 length = _mm_sqrt_ps(lengthsq);
+		_store4(p_dst + i,
+				_mm_and_ps(_mm_div_ps(x, length), nonzero),
+				_mm_and_ps(_mm_div_ps(y, length), nonzero),
+				_mm_and_ps(_mm_div_ps(z, length), nonzero));
+	}
+#endif
+	for (; i < p_count; i++) {
+		p_dst[i] = p_src[i].normalized();
+	}
+}
+
+void dot(const Vector3 *p_a, const Vector3 *p_b, real_t *r_dst, int64_t p_count) {
+	int64_t i = 0;
+#ifdef VECTOR3_BATCH_SSE2
+	for (; i + 4 <= p_count; i += 4) {
+		__m128 ax, ay, az, bx, by, bz;
+		_load4(p_a + i, ax, ay, az);
+		_load4(p_b + i, bx, by, bz);
+		_mm_storeu_ps(r_dst + i, _dot(ax, ay, az, bx, by, bz));
+	}
+#endif
+	for (; i < p_count; i++) {
+		r_dst[i] = p_a[i].dot(p_b[i]);
+	}
+}
+
+void cross(const Vector3 *p_a, const Vector3 *p_b, Vector3 *p_dst, int64_t p_count) {
+	int64_t i = 0;
+#ifdef VECTOR3_BATCH_SSE2
+	for (; i + 4 <= p_count; i += 4) {
+		__m128 ax, ay, az, bx, by, bz;
+		_load4(p_a + i, ax, ay, az);
+		_load4(p_b + i, bx, by, bz);
+		_store4(p_dst + i,
+				_mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)),
+				_mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz)),
+				_mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)));
+	}
+#endif
+	for (; i < p_count; i++) {
+		p_dst[i] = p_a[i].cross(p_b[i]);
+	}
+}
+
+AABB get_aabb(const Vector3 *p_points, int64_t p_count, int64_t p_stride) {
+	if (p_count <= 0) {
+		return AABB();
+	}
+
+	const uint8_t *src = reinterpret_cast<const uint8_t *>(p_points);
+	Vector3 begin = p_points[0];
+	Vector3 end = begin;
+	int64_t i = 1;
+
+#ifdef VECTOR3_BATCH_SSE2
+	if (p_stride == sizeof(Vector3) && p_count >= 4) {
+		// Four points fill three registers, each lane always holding the same axis
+		// (x y z x, y z x y, z x y z), so no shuffling is needed until the end.
+		const float *points = reinterpret_cast<const float *>(p_points);
+		__m128 min_a = _mm_loadu_ps(points), min_b = _mm_loadu_ps(points + 4), min_c = _mm_loadu_ps(points + 8);
+		__m128 max_a = min_a, max_b = min_b, max_c = min_c;
+		for (i = 4; i + 4 <= p_count; i += 4) {
+			const float *group = points + i * 3;
+			const __m128 a = _mm_loadu_ps(group);
+			const __m128 b = _mm_loadu_ps(group + 4);
+			const __m128 c = _mm_loadu_ps(group + 8);
+			min_a = _mm_min_ps(min_a, a);
+			min_b = _mm_min_ps(min_b, b);
+			min_c = _mm_min_ps(min_c, c);
+			max_a = _mm_max_ps(max_a, a);
+			max_b = _mm_max_ps(max_b, b);
+			max_c = _mm_max_ps(max_c, c);
+		}
+
+		__m128 min_x, min_y, min_z, max_x, max_y, max_z;
+		_load4_registers(min_a, min_b, min_c, min_x, min_y, min_z);
+		_load4_registers(max_a, max_b, max_c, max_x, max_y, max_z);
+		alignas(16) float lanes[6][4];
+		_mm_store_ps(lanes[0], min_x);
+		_mm_store_ps(lanes[1], min_y);
+		_mm_store_ps(lanes[2], min_z);
+		_mm_store_ps(lanes[3], max_x);
+		_mm_store_ps(lanes[4], max_y);
+		_mm_store_ps(lanes[5], max_z);
+		for (int lane = 0; lane < 4; lane++) {
+			begin = begin.min(Vector3(lanes[0][lane], lanes[1][lane], lanes[2][lane]));
+			end = end.max(Vector3(lanes[3][lane], lanes[4][lane], lanes[5][lane]));
+		}
+	}
+#endif
+
+	for (; i < p_count; i++) {
+		const Vector3 &point = *reinterpret_cast<const Vector3 *>(src + i * p_stride);
+		begin = begin.min(point);
+		end = end.max(point);
+	}
+
+	return AABB(begin, end - begin);
+}
+
+} // namespace Vector3Batch
@@ -0,0 +1,56 @@
+/**************************************************************************/
+/*  vector3_batch.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/aabb.h"
+#include "core/math/basis.h"
+
+struct Transform3D;
+
+/**
+ * Kernels working on contiguous arrays of Vector3, such as the contents of a PackedVector3Array.
+ * When real_t is float and SSE2 is available, four vectors are processed at once; otherwise the
+ * kernels fall back to the scalar Vector3 operations. Results are identical in both cases.
+ * The source and destination arrays may be the same.
+ */
+namespace Vector3Batch {
+
+void transform(const Transform3D &p_xform, const Vector3 *p_src, Vector3 *p_dst, int64_t p_count);
+void transform(const Basis &p_basis, const Vector3 *p_src, Vector3 *p_dst, int64_t p_count);
+void normalize(const Vector3 *p_src, Vector3 *p_dst, int64_t p_count);
+void dot(const Vector3 *p_a, const Vector3 *p_b, real_t *r_dst, int64_t p_count);
+void cross(const Vector3 *p_a, const Vector3 *p_b, Vector3 *p_dst, int64_t p_count);
+
+// Smallest AABB containing all points. A stride other than sizeof(Vector3) allows reading
+// positions stored in an array of larger structures.
+AABB get_aabb(const Vector3 *p_points, int64_t p_count, int64_t p_stride = sizeof(Vector3));
+
+} // namespace Vector3Batch
@@ -84,17 +84,38 @@ Error CallQueue::push_set(Object *p_object, const StringName &p_prop, const Vari
 }
 
 Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	return _push_callablep(p_callable, p_args, p_argcount, p_show_error, false);
+}
+
+Error CallQueue::push_callable_coalesced(const Callable &p_callable, bool p_show_error) {
+	return _push_callablep(p_callable, nullptr, 0, p_show_error, true);
+}
+
+Error CallQueue::_push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error, bool p_coalesce) {
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
 	LOCK_MUTEX;
 
+	if (p_coalesce) {
+		if (coalesced_calls.has(p_callable)) {
+			// Already queued, the pending call will do.
+			coalesced_count++;
+			UNLOCK_MUTEX;
+			return OK;
+		}
+		coalesced_calls.insert(p_callable);
+	}
+
 	_ensure_first_page();
 
 	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
 		if (pages_used == max_pages) {
 			fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
+			if (p_coalesce) {
+				coalesced_calls.erase(p_callable);
+			}
 			statistics();
 			UNLOCK_MUTEX;
 			return ERR_OUT_OF_MEMORY;
@@ -113,6 +134,9 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 	if (p_show_error) {
 		msg->type |= FLAG_SHOW_ERROR;
 	}
+	if (p_coalesce) {
+		msg->type |= FLAG_COALESCED;
+	}
 	// Support callables of static methods.
 	if (p_callable.get_object_id().is_null() && p_callable.is_valid()) {
 		msg->type |= FLAG_NULL_IS_OK;
@@ -259,6 +283,15 @@ Error CallQueue::flush() {
 
 		Object *target = message->callable.get_object();
 
+		if (message->type & FLAG_COALESCED) {
+			// Allow the call to be queued again, even from within itself.
+			coalesced_calls.erase(message->callable);
+		}
+		if (!target && !(message->type & FLAG_NULL_IS_OK)) {
+			// Object was deleted.
+			dropped_count++;
+		}
+
 		UNLOCK_MUTEX;
 
 		switch (message->type & FLAG_MASK) {
@@ -337,11 +370,13 @@ void CallQueue::clear() {
 			}
 
 			message->~Message();
+			dropped_count++;
 		}
 	}
 
 	pages_used = 1;
 	page_bytes[0] = 0;
+	coalesced_calls.clear();
 
 	UNLOCK_MUTEX;
 }
@@ -425,6 +460,7 @@ void CallQueue::statistics() {
 
 	fprintf(stdout, "TOTAL PAGES: %d (%d bytes).\n", pages_used, pages_used * PAGE_SIZE_BYTES);
 	fprintf(stdout, "NULL count: %d.\n", null_count);
+	fprintf(stdout, "Coalesced calls: %s, dropped messages: %s.\n", itos(coalesced_count).utf8().get_data(), itos(dropped_count).utf8().get_data());
 
 	for (const KeyValue<StringName, int> &E : set_count) {
 		fprintf(stdout, "SET %s: %d.\n", String(E.key).utf8().get_data(), E.value);
@@ -460,6 +496,14 @@ int CallQueue::get_max_buffer_usage() const {
 	return pages.size() * PAGE_SIZE_BYTES;
 }
 
+uint64_t CallQueue::get_coalesced_message_count() const {
+	return coalesced_count;
+}
+
+uint64_t CallQueue::get_dropped_message_count() const {
+	return dropped_count;
+}
+
 CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text) {
 	if (p_custom_allocator) {
 		allocator = p_custom_allocator;
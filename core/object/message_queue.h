@@ -32,6 +32,7 @@
 
 #include "core/object/object_id.h"
 #include "core/os/thread_safe.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
 #include "core/variant/variant.h"
@@ -60,9 +61,10 @@ private:
 		TYPE_NOTIFICATION,
 		TYPE_SET,
 		TYPE_END, // End marker.
+		FLAG_COALESCED = 1 << 12,
 		FLAG_NULL_IS_OK = 1 << 13,
 		FLAG_SHOW_ERROR = 1 << 14,
-		FLAG_MASK = FLAG_NULL_IS_OK - 1,
+		FLAG_MASK = FLAG_COALESCED - 1,
 	};
 
 	Mutex mutex;
@@ -76,6 +78,11 @@ private:
 	uint32_t pages_used = 0;
 	bool flushing = false;
 
+	// Coalesced calls that are queued and not yet flushed.
+	HashSet<Callable, HashableHasher<Callable>> coalesced_calls;
+	uint64_t coalesced_count = 0;
+	uint64_t dropped_count = 0;
+
 #ifdef DEV_ENABLED
 	bool is_current_thread_override = false;
 #endif
@@ -100,6 +107,7 @@ private:
 	void _add_page();
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
+	Error _push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error, bool p_coalesce);
 
 	String error_text;
 
@@ -116,6 +124,8 @@ public:
 	}
 
 	Error push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error = false);
+	// Queues a call without arguments, unless the same callable is already queued and not yet flushed.
+	Error push_callable_coalesced(const Callable &p_callable, bool p_show_error = false);
 	Error push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value);
 	Error push_notification(ObjectID p_id, int p_notification);
 
@@ -151,6 +161,8 @@ public:
 
 	bool is_flushing() const;
 	int get_max_buffer_usage() const;
+	uint64_t get_coalesced_message_count() const;
+	uint64_t get_dropped_message_count() const;
 
 	CallQueue(Allocator *p_custom_allocator = nullptr, uint32_t p_max_pages = 8192, const String &p_error_text = String());
 	virtual ~CallQueue();
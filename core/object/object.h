@@ -617,9 +617,24 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		struct EmitSlot {
+			Callable callable;
+			uint32_t flags = 0;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		// Flattened slots used by emission, rebuilt on the next emission after a connection change.
+		// Emissions in progress keep their own reference, so it is never modified in place.
+		Vector<EmitSlot> emit_slots;
+		bool emit_slots_dirty = true;
+		bool has_one_shot = false;
 		bool removable = false;
+
+		void invalidate_emit_slots() {
+			emit_slots.clear();
+			emit_slots_dirty = true;
+		}
 	};
 	friend struct _ObjectSignalLock;
 	mutable Mutex *signal_mutex = nullptr;
@@ -1081,3 +1096,22 @@ public:
 	static void debug_objects(DebugFunc p_func);
 	static int get_object_count();
 };
+
+#ifdef DEBUG_ENABLED
+// Keeps the object from freeing itself while one of its methods runs, see Object::callp().
+// Needed by anything calling method binds directly instead of going through callp().
+struct _ObjectDebugLock {
+	ObjectID obj_id;
+
+	_ObjectDebugLock(Object *p_obj) {
+		obj_id = p_obj->get_instance_id();
+		p_obj->_lock_index.ref();
+	}
+	~_ObjectDebugLock() {
+		Object *obj_ptr = ObjectDB::get_instance(obj_id);
+		if (likely(obj_ptr)) {
+			obj_ptr->_lock_index.unref();
+		}
+	}
+};
+#endif // DEBUG_ENABLED
@@ -72,32 +72,29 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		// about to be run uses scripting, guarantees are held.
 		ScriptServer::thread_enter();
 
-		task_mutex.lock();
-		p_task->pool_thread_index = pool_thread_index;
-		prev_task = curr_thread.current_task;
-		curr_thread.current_task = p_task;
+		p_task->pool_thread_index.store(pool_thread_index);
+		prev_task = curr_thread.current_task.load(std::memory_order_relaxed);
+		curr_thread.current_task.store(p_task, std::memory_order_release);
 		curr_thread.has_pump_task = p_task->is_pump_task;
-		if (p_task->pending_notify_yield_over) {
+		// Pairs with notify_yield_over(), whichever of both sees the write of the other one takes the flag.
+		if (p_task->pending_notify_yield_over.load() && p_task->pending_notify_yield_over.exchange(false)) {
+			MutexLock task_lock(task_mutex);
 			curr_thread.yield_is_over = true;
 		}
-		task_mutex.unlock();
 	}
 #endif
 
 #ifdef THREADS_ENABLED
 	bool low_priority = p_task->low_priority;
 #endif
+	LocalVector<Task *> ready_dependents;
 
 	if (p_task->group) {
 		// Handling a group
 		bool do_post = false;
 
-		while (true) {
-			uint32_t work_index = p_task->group->index.postincrement();
-
-			if (work_index >= p_task->group->max) {
-				break;
-			}
+		uint32_t work_index = 0;
+		while (_claim_group_work_index(p_task->group, p_task->group_range, work_index)) {
 			if (p_task->native_group_func) {
 				p_task->native_group_func(p_task->native_func_userdata, work_index);
 			} else if (p_task->template_userdata) {
@@ -119,8 +116,11 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		}
 
 		if (do_post) {
+			// Completion and dependents registration must be atomic relative to each other.
+			MutexLock task_lock(task_mutex);
 			p_task->group->done_semaphore.post();
 			p_task->group->completed.set_to(true);
+			_release_dependents(p_task->group->dependents, ready_dependents);
 		}
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
@@ -147,7 +147,8 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 
 		task_mutex.lock();
 		p_task->completed = true;
-		p_task->pool_thread_index = -1;
+		p_task->pool_thread_index.store(-1);
+		_release_dependents(p_task->dependents, ready_dependents);
 		if (p_task->waiting_user) {
 			p_task->done_semaphore.post(p_task->waiting_user);
 		}
@@ -162,7 +163,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 
 #ifdef THREADS_ENABLED
 	{
-		curr_thread.current_task = prev_task;
+		curr_thread.current_task.store(prev_task, std::memory_order_release);
 		if (low_priority) {
 			low_priority_threads_used--;
 
@@ -179,6 +180,57 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	set_current_thread_safe_for_nodes(safe_for_nodes_backup);
 	MessageQueue::set_thread_singleton_override(call_queue_backup);
 #endif
+
+	if (!ready_dependents.is_empty()) {
+		_post_ready_dependents(ready_dependents);
+	}
+}
+
+static _FORCE_INLINE_ uint64_t _pack_group_range(uint32_t p_begin, uint32_t p_end) {
+	return ((uint64_t)p_end << 32) | p_begin;
+}
+
+bool WorkerThreadPool::_claim_group_work_index(Group *p_group, uint32_t p_range, uint32_t &r_index) {
+	SafeNumeric<uint64_t> &own_range = p_group->ranges[p_range];
+
+	// Fast path: take the next index from the range owned by this task.
+	uint64_t range = own_range.get();
+	while (true) {
+		uint32_t begin = range & UINT32_MAX;
+		uint32_t end = range >> 32;
+		if (begin >= end) {
+			break;
+		}
+		if (own_range.compare_exchange_weak(range, _pack_group_range(begin + 1, end))) {
+			r_index = begin;
+			return true;
+		}
+	}
+
+	// Own range is exhausted, so steal the upper half of the next non-empty one.
+	// Ranges only ever shrink and never overlap, so a stale read just makes the exchange fail.
+	for (uint32_t i = 1; i < p_group->range_count; i++) {
+		SafeNumeric<uint64_t> &victim_range = p_group->ranges[(p_range + i) % p_group->range_count];
+		range = victim_range.get();
+		while (true) {
+			uint32_t begin = range & UINT32_MAX;
+			uint32_t end = range >> 32;
+			if (begin >= end) {
+				break;
+			}
+			uint32_t stolen_begin = end - (end - begin + 1) / 2;
+			if (victim_range.compare_exchange_weak(range, _pack_group_range(begin, stolen_begin))) {
+				r_index = stolen_begin;
+				if (stolen_begin + 1 < end) {
+					// Publish the rest of the stolen range so it can be stolen again.
+					own_range.set(_pack_group_range(stolen_begin + 1, end));
+				}
+				return true;
+			}
+		}
+	}
+
+	return false;
 }
 
 void WorkerThreadPool::_thread_function(void *p_user) {
@@ -186,8 +238,9 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 	Thread::set_name(vformat("WorkerThread %d", thread_data->index));
 
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		// Local queues don't need the lock, so try them first.
+		Task *task_to_process = thread_data->pool->_pop_local_task(thread_data);
+		if (!task_to_process) {
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
 			MutexLock lock(thread_data->pool->task_mutex);
@@ -200,17 +253,15 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 
 				thread_data->signaled = false;
 
-				if (!thread_data->pool->task_queue.first()) {
-					// There wasn't a task available yet.
-					// Let's wait for the next notification, then recheck.
-					thread_data->cond_var.wait(lock);
-					continue;
+				// Got a task to process? It's already removed from its queue, so break into the task handling section.
+				task_to_process = thread_data->pool->_pop_task(thread_data, true);
+				if (task_to_process) {
+					break;
 				}
 
-				// Got a task to process! Remove it from the queue, then break into the task handling section.
-				task_to_process = thread_data->pool->task_queue.first()->self();
-				thread_data->pool->task_queue.remove(thread_data->pool->task_queue.first());
-				break;
+				// There wasn't a task available yet.
+				// Let's wait for the next notification, then recheck.
+				thread_data->pool->_wait_for_tasks(thread_data, lock);
 			}
 		}
 
@@ -219,7 +270,7 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 	}
 }
 
-void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock, bool p_pump_task) {
+uint32_t WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock, bool p_pump_task) {
 	// Fall back to processing on the calling thread if there are no worker threads.
 	// Separated into its own variable to make it easier to extend this logic
 	// in custom builds.
@@ -232,7 +283,7 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 			_process_task(p_tasks[i]);
 		}
 		p_lock.temp_relock();
-		return;
+		return 0;
 	}
 
 	while (runlevel == RUNLEVEL_EXIT_LANGUAGES) {
@@ -241,25 +292,54 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 
 	uint32_t to_process = 0;
 	uint32_t to_promote = 0;
+	uint32_t local_count = 0;
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
 
 	for (uint32_t i = 0; i < p_count; i++) {
-		p_tasks[i]->low_priority = !p_high_priority;
+		Task *task = p_tasks[i];
+		task->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
+			if (caller_pool_thread && !p_pump_task) {
+				// Keep tasks spawned from a pool thread close to it. Idle threads will steal them if needed.
+				task->queue_thread_index = caller_pool_thread->index;
+				p_tasks[local_count++] = task;
+			} else {
+				task_queue.add_last(&task->task_elem);
+				to_process++;
+			}
 			if (!p_high_priority) {
 				low_priority_threads_used++;
 			}
-			to_process++;
 		} else {
 			// Too many threads using low priority, must go to queue.
-			low_priority_task_queue.add_last(&p_tasks[i]->task_elem);
+			low_priority_task_queue.add_last(&task->task_elem);
 			to_promote++;
 		}
 	}
 
 	_notify_threads(caller_pool_thread, to_process, to_promote);
+
+	return local_count;
+}
+
+void WorkerThreadPool::_push_local_tasks(Task **p_tasks, uint32_t p_count) {
+	if (p_count == 0) {
+		return;
+	}
+
+	ThreadData *thread_data = &threads.ptr()[get_thread_index()];
+	for (uint32_t i = 0; i < p_count; i++) {
+		thread_data->local_queue.push(p_tasks[i]);
+	}
+
+	// Pairs with the fence in _wait_for_tasks(), so either a thread about to sleep sees these tasks,
+	// or this sees it sleeping. Only then is the lock needed, to wake it up.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (sleeping_threads.load(std::memory_order_relaxed)) {
+		MutexLock task_lock(task_mutex);
+		_notify_threads(thread_data, p_count, 0);
+	}
 }
 
 void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count) {
@@ -286,9 +366,10 @@ void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data,
 		if (th.signaled) {
 			continue;
 		}
-		if (th.current_task) {
+		Task *current_task = th.current_task.load(std::memory_order_acquire);
+		if (current_task) {
 			// Good thread for promoting low-prio?
-			if (to_promote && th.awaited_task && th.current_task->low_priority) {
+			if (to_promote && th.awaited_task && current_task->low_priority) {
 				if (likely(&th != p_current_thread_data)) {
 					th.cond_var.notify_one();
 				}
@@ -338,56 +419,226 @@ bool WorkerThreadPool::_try_promote_low_priority_task() {
 	}
 }
 
+void WorkerThreadPool::_release_dependents(LocalVector<Task *> &p_dependents, LocalVector<Task *> &r_ready) {
+	for (Task *dependent : p_dependents) {
+		DEV_ASSERT(dependent->pending_dependencies > 0);
+		dependent->pending_dependencies--;
+		if (dependent->pending_dependencies == 0) {
+			r_ready.push_back(dependent);
+		}
+	}
+	p_dependents.clear();
+}
+
+void WorkerThreadPool::_post_ready_dependents(LocalVector<Task *> &p_ready) {
+	uint32_t local_count = 0;
+	{
+		MutexLock<BinaryMutex> lock(task_mutex);
+		for (uint32_t i = 0; i < p_ready.size(); i++) {
+			Task *task = p_ready[i];
+			if (_post_tasks(&task, 1, !task->low_priority, lock, false)) {
+				p_ready[local_count++] = task;
+			}
+		}
+	}
+	_push_local_tasks(p_ready.ptr(), local_count);
+}
+
+bool WorkerThreadPool::_has_local_tasks() const {
+	const ThreadData *thread_datas = threads.ptr();
+	uint32_t thread_count = queue_thread_count.load(std::memory_order_acquire);
+	for (uint32_t i = 0; i < thread_count; i++) {
+		if (!thread_datas[i].local_queue.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_steal_task(ThreadData *p_thread_data) {
+	// Steal the oldest task from another thread, starting at a random one to spread the load.
+	ThreadData *thread_datas = threads.ptr();
+	uint32_t thread_count = queue_thread_count.load(std::memory_order_acquire);
+	uint32_t seed = p_thread_data->steal_seed;
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	p_thread_data->steal_seed = seed;
+	Task *task = nullptr;
+	for (uint32_t i = 0; i < thread_count; i++) {
+		ThreadData &victim = thread_datas[(seed + i) % thread_count];
+		if (&victim != p_thread_data && victim.local_queue.steal(task)) {
+			return task;
+		}
+	}
+	return nullptr;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_pop_local_task(ThreadData *p_thread_data) {
+	// Own queue first, newest task first, since that's the one most likely to be hot in cache.
+	Task *task = nullptr;
+	if (p_thread_data->local_queue.pop(task)) {
+		return task;
+	}
+	return _steal_task(p_thread_data);
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_pop_task(ThreadData *p_thread_data, bool p_allow_pump_task) {
+	Task *task = nullptr;
+	if (p_thread_data->local_queue.pop(task)) {
+		return task;
+	}
+
+	SelfList<Task> *E = task_queue.first();
+	if (E) {
+		if (p_allow_pump_task || !E->self()->is_pump_task) {
+			task_queue.remove(E);
+			return E->self();
+		}
+		// Leave the pump task to a thread that can take it.
+		_notify_threads(p_thread_data, 1, 0);
+	}
+
+	return _steal_task(p_thread_data);
+}
+
+void WorkerThreadPool::_wait_for_tasks(ThreadData *p_thread_data, MutexLock<BinaryMutex> &p_lock) {
+	// Tasks are pushed to local queues without the lock, see _push_local_tasks().
+	sleeping_threads.fetch_add(1);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!_has_local_tasks()) {
+		p_thread_data->cond_var.wait(p_lock);
+	}
+	sleeping_threads.fetch_sub(1);
+}
+
+bool WorkerThreadPool::_try_cancel_task(TaskID p_task_id) {
+	MutexLock task_lock(task_mutex);
+	Task **taskp = tasks.getptr(p_task_id);
+	ERR_FAIL_NULL_V(taskp, false);
+	Task *task = *taskp;
+	if (task->low_priority || task->is_pump_task || task->waiting_pool || task->waiting_user || !task->dependents.is_empty()) {
+		return false;
+	}
+
+	if (task->task_elem.in_list()) {
+		task->task_elem.remove_from_list();
+	} else {
+		// Only the owner of a local queue can take tasks back from it. Thieves may be racing for the same task,
+		// so pop it the regular way, and put back whatever else turns up.
+		int thread_index = get_thread_index();
+		if (thread_index == -1 || task->queue_thread_index != thread_index) {
+			return false;
+		}
+		WorkStealingDeque<Task *> &local_queue = threads[thread_index].local_queue;
+		Task *newest = nullptr;
+		if (!local_queue.pop(newest)) {
+			return false;
+		}
+		if (newest != task) {
+			local_queue.push(newest);
+			return false;
+		}
+	}
+
+	if (task->template_userdata) {
+		memdelete(task->template_userdata);
+	}
+	tasks.erase(p_task_id);
+	task_allocator.free(task);
+	return true;
+}
+
 WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *), void *p_userdata, bool p_high_priority, const String &p_description) {
 	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description);
 }
 
-WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task) {
-	MutexLock<BinaryMutex> lock(task_mutex);
+WorkerThreadPool::TaskID WorkerThreadPool::add_dependent_native_task(void (*p_func)(void *), void *p_userdata, Span<TaskID> p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(Callable(), p_func, p_userdata, nullptr, p_high_priority, p_description, false, p_dependencies);
+}
 
-	// Get a free task
-	Task *task = task_allocator.alloc();
-	TaskID id = last_task++;
-	task->self = id;
-	task->callable = p_callable;
-	task->native_func = p_func;
-	task->native_func_userdata = p_userdata;
-	task->description = p_description;
-	task->template_userdata = p_template_userdata;
-	task->is_pump_task = p_pump_task;
-	tasks.insert(id, task);
+WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task, Span<TaskID> p_dependencies) {
+	Task *task = nullptr;
+	TaskID id;
+	uint32_t local_count = 0;
+	{
+		MutexLock<BinaryMutex> lock(task_mutex);
+
+		// Get a free task
+		task = task_allocator.alloc();
+		id = last_task++;
+		task->self = id;
+		task->callable = p_callable;
+		task->native_func = p_func;
+		task->native_func_userdata = p_userdata;
+		task->description = p_description;
+		task->template_userdata = p_template_userdata;
+		task->is_pump_task = p_pump_task;
+		tasks.insert(id, task);
 
 #ifdef THREADS_ENABLED
-	if (p_pump_task) {
-		pump_task_count++;
-		int thread_count = get_thread_count();
-		if (pump_task_count >= thread_count) {
-			print_verbose(vformat("A greater number of dedicated threads were requested (%d) than threads available (%d). Please increase the number of available worker task threads. Recovering this session by spawning more worker task threads.", pump_task_count + 1, thread_count)); // +1 because we want to keep a Thread without any pump tasks free.
+		if (p_pump_task) {
+			pump_task_count++;
+			int thread_count = get_thread_count();
+			if (pump_task_count >= thread_count) {
+				print_verbose(vformat("A greater number of dedicated threads were requested (%d) than threads available (%d). Please increase the number of available worker task threads. Recovering this session by spawning more worker task threads.", pump_task_count + 1, thread_count)); // +1 because we want to keep a Thread without any pump tasks free.
 
-			Thread::Settings settings;
+				Thread::Settings settings;
 #ifdef __APPLE__
-			// The default stack size for new threads on Apple platforms is 512KiB.
-			// This is insufficient when using a library like SPIRV-Cross,
-			// which can generate deep stacks and result in a stack overflow.
+				// The default stack size for new threads on Apple platforms is 512KiB.
+				// This is insufficient when using a library like SPIRV-Cross,
+				// which can generate deep stacks and result in a stack overflow.
 #ifdef DEV_ENABLED
-			// Debug builds need an even larger stack size.
-			settings.stack_size = 2 * 1024 * 1024; // 2 MiB
+				// Debug builds need an even larger stack size.
+				settings.stack_size = 2 * 1024 * 1024; // 2 MiB
 #else
-			settings.stack_size = 1 * 1024 * 1024; // 1 MiB
+				settings.stack_size = 1 * 1024 * 1024; // 1 MiB
 #endif
 #endif
-			// Re-sizing implies relocation, which is not supported for this array.
-			CRASH_COND_MSG(thread_count + 1 > (int)threads.get_capacity(), "Reserve trick for worker thread pool failed. Crashing.");
-			threads.resize_initialized(thread_count + 1);
-			threads[thread_count].index = thread_count;
-			threads[thread_count].pool = this;
-			threads[thread_count].thread.start(&WorkerThreadPool::_thread_function, &threads[thread_count], settings);
-			thread_ids.insert(threads[thread_count].thread.get_id(), thread_count);
+				// Re-sizing implies relocation, which is not supported for this array.
+				CRASH_COND_MSG(thread_count + 1 > (int)threads.get_capacity(), "Reserve trick for worker thread pool failed. Crashing.");
+				threads.resize_initialized(thread_count + 1);
+				threads[thread_count].index = thread_count;
+				threads[thread_count].pool = this;
+				threads[thread_count].steal_seed = thread_count + 1;
+				threads[thread_count].thread.start(&WorkerThreadPool::_thread_function, &threads[thread_count], settings);
+				thread_ids.insert(threads[thread_count].thread.get_id(), thread_count);
+				queue_thread_count.store(thread_count + 1, std::memory_order_release);
+			}
 		}
-	}
 #endif
 
-	_post_tasks(&task, 1, p_high_priority, lock, p_pump_task);
+		for (const TaskID &dependency_id : p_dependencies) {
+			Task **dependency_taskp = tasks.getptr(dependency_id);
+			if (dependency_taskp) {
+				if (!(*dependency_taskp)->completed) {
+					(*dependency_taskp)->dependents.push_back(task);
+					task->pending_dependencies++;
+				}
+				continue;
+			}
+			Group **dependency_groupp = groups.getptr(dependency_id);
+			if (dependency_groupp) {
+				if (!(*dependency_groupp)->completed.is_set()) {
+					(*dependency_groupp)->dependents.push_back(task);
+					task->pending_dependencies++;
+				}
+				continue;
+			}
+			ERR_PRINT(vformat("Invalid Task or Group ID as dependency: %d. Maybe it was already awaited and disposed of.", dependency_id));
+		}
+
+		if (task->pending_dependencies) {
+			// Will be posted when the last dependency completes.
+			task->low_priority = !p_high_priority;
+			return id;
+		}
+
+		local_count = _post_tasks(&task, 1, p_high_priority, lock, p_pump_task);
+	}
+
+	// Outside of the lock, since local queues don't need it.
+	_push_local_tasks(&task, local_count);
 
 	return id;
 }
@@ -400,6 +651,10 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_task_bind(const Callable &p_actio
 	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, false);
 }
 
+WorkerThreadPool::TaskID WorkerThreadPool::add_dependent_task(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority, const String &p_description) {
+	return _add_task(p_action, nullptr, nullptr, nullptr, p_high_priority, p_description, false, p_dependencies);
+}
+
 bool WorkerThreadPool::is_task_completed(TaskID p_task_id) const {
 	MutexLock task_lock(task_mutex);
 	const Task *const *taskp = tasks.getptr(p_task_id);
@@ -429,7 +684,7 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	}
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
-	if (caller_pool_thread && p_task_id <= caller_pool_thread->current_task->self) {
+	if (caller_pool_thread && p_task_id <= caller_pool_thread->current_task.load(std::memory_order_relaxed)->self) {
 		// Deadlock prevention:
 		// When a pool thread wants to wait for an older task, the following situations can happen:
 		// 1. Awaited task is deep in the stack of the awaiter.
@@ -475,6 +730,25 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	return OK;
 }
 
+Error WorkerThreadPool::wait_for_task_graph_completion(const Vector<TaskID> &p_ids) {
+	Error err = OK;
+	for (const TaskID &id : p_ids) {
+		task_mutex.lock();
+		bool is_group = groups.has(id);
+		task_mutex.unlock();
+
+		if (is_group) {
+			wait_for_group_task_completion(id);
+		} else {
+			Error task_err = wait_for_task_completion(id);
+			if (task_err != OK && err == OK) {
+				err = task_err;
+			}
+		}
+	}
+	return err;
+}
+
 void WorkerThreadPool::_lock_unlockable_mutexes() {
 #ifdef THREADS_ENABLED
 	for (uint32_t i = 0; i < MAX_UNLOCKABLE_LOCKS; i++) {
@@ -528,8 +802,8 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
-					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
+					uint32_t to_process = _has_queued_tasks() ? 1 : 0;
+					uint32_t to_promote = p_caller_pool_thread->current_task.load(std::memory_order_relaxed)->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
 						p_caller_pool_thread->signaled = true;
@@ -540,21 +814,13 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				break;
 			}
 
-			if (p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first()) {
+			if (p_caller_pool_thread->current_task.load(std::memory_order_relaxed)->low_priority && low_priority_task_queue.first()) {
 				if (_try_promote_low_priority_task()) {
 					_notify_threads(p_caller_pool_thread, 1, 0);
 				}
 			}
 
-			if (p_caller_pool_thread->pool->task_queue.first()) {
-				task_to_process = task_queue.first()->self();
-				if ((p_task == ThreadData::YIELDING || p_caller_pool_thread->has_pump_task == true) && task_to_process->is_pump_task) {
-					task_to_process = nullptr;
-					_notify_threads(p_caller_pool_thread, 1, 0);
-				} else {
-					task_queue.remove(task_queue.first());
-				}
-			}
+			task_to_process = _pop_task(p_caller_pool_thread, p_task != ThreadData::YIELDING && !p_caller_pool_thread->has_pump_task);
 
 			if (!task_to_process) {
 				p_caller_pool_thread->awaited_task = p_task;
@@ -564,7 +830,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				}
 				relock_unlockables = true;
 
-				p_caller_pool_thread->cond_var.wait(lock);
+				_wait_for_tasks(p_caller_pool_thread, lock);
 
 				p_caller_pool_thread->awaited_task = nullptr;
 			}
@@ -599,7 +865,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!_has_queued_tasks() && !low_priority_task_queue.first()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -648,15 +914,20 @@ void WorkerThreadPool::notify_yield_over(TaskID p_task_id) {
 		ERR_FAIL_MSG("Invalid Task ID.");
 	}
 	Task *task = *taskp;
-	if (task->pool_thread_index == -1) { // Completed or not started yet.
-		if (!task->completed) {
-			// This avoids a race condition where a task is created and yield-over called before it's processed.
-			task->pending_notify_yield_over = true;
-		}
+	if (task->completed) {
 		return;
 	}
 
-	ThreadData &td = threads[task->pool_thread_index];
+	// Tasks are started without the lock, so this can't rely on pool_thread_index alone.
+	// This avoids a race condition where a task is created and yield-over called before it's processed.
+	task->pending_notify_yield_over.store(true);
+	int pool_thread_index = task->pool_thread_index.load();
+	if (pool_thread_index == -1 || !task->pending_notify_yield_over.exchange(false)) {
+		// Not started yet, or the thread that started it took the flag itself.
+		return;
+	}
+
+	ThreadData &td = threads[pool_thread_index];
 	td.yield_is_over = true;
 	td.signaled = true;
 	td.cond_var.notify_one();
@@ -668,43 +939,57 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 		p_tasks = MAX(1u, threads.size());
 	}
 
-	MutexLock<BinaryMutex> lock(task_mutex);
-
-	Group *group = group_allocator.alloc();
-	GroupID id = last_task++;
-	group->max = p_elements;
-	group->self = id;
-
 	Task **tasks_posted = nullptr;
-	if (p_elements == 0) {
-		// Should really not call it with zero Elements, but at least it should work.
-		group->completed.set_to(true);
-		group->done_semaphore.post();
-		group->tasks_used = 0;
-		p_tasks = 0;
-		if (p_template_userdata) {
-			memdelete(p_template_userdata);
-		}
+	GroupID id;
+	uint32_t local_count = 0;
+	{
+		MutexLock<BinaryMutex> lock(task_mutex);
+
+		Group *group = group_allocator.alloc();
+		id = last_task++;
+		group->max = p_elements;
+		group->self = id;
+
+		if (p_elements == 0) {
+			// Should really not call it with zero Elements, but at least it should work.
+			group->completed.set_to(true);
+			group->done_semaphore.post();
+			group->tasks_used = 0;
+			p_tasks = 0;
+			if (p_template_userdata) {
+				memdelete(p_template_userdata);
+			}
 
-	} else {
-		group->tasks_used = p_tasks;
-		tasks_posted = (Task **)alloca(sizeof(Task *) * p_tasks);
-		for (int i = 0; i < p_tasks; i++) {
-			Task *task = task_allocator.alloc();
-			task->native_group_func = p_func;
-			task->native_func_userdata = p_userdata;
-			task->description = p_description;
-			task->group = group;
-			task->callable = p_callable;
-			task->template_userdata = p_template_userdata;
-			tasks_posted[i] = task;
-			// No task ID is used.
+		} else {
+			group->tasks_used = p_tasks;
+			group->ranges = memnew_arr(SafeNumeric<uint64_t>, p_tasks);
+			group->range_count = p_tasks;
+			tasks_posted = (Task **)alloca(sizeof(Task *) * p_tasks);
+			for (int i = 0; i < p_tasks; i++) {
+				// Split the elements evenly; imbalance is fixed later by stealing.
+				uint32_t begin = (uint64_t)p_elements * i / p_tasks;
+				uint32_t end = (uint64_t)p_elements * (i + 1) / p_tasks;
+				group->ranges[i].set(_pack_group_range(begin, end));
+
+				Task *task = task_allocator.alloc();
+				task->native_group_func = p_func;
+				task->native_func_userdata = p_userdata;
+				task->description = p_description;
+				task->group = group;
+				task->group_range = i;
+				task->callable = p_callable;
+				task->template_userdata = p_template_userdata;
+				tasks_posted[i] = task;
+				// No task ID is used.
+			}
 		}
-	}
 
-	groups[id] = group;
+		groups[id] = group;
+
+		local_count = _post_tasks(tasks_posted, p_tasks, p_high_priority, lock, false);
+	}
 
-	_post_tasks(tasks_posted, p_tasks, p_high_priority, lock, false);
+	_push_local_tasks(tasks_posted, local_count);
 
 	return id;
 }
@@ -769,6 +1054,17 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 #endif
 }
 
+uint32_t WorkerThreadPool::_get_parallel_chunk_size(uint32_t p_count, uint32_t p_grain) {
+	p_grain = MAX(p_grain, 1u);
+	if (!singleton || singleton->get_thread_count() < 2 || p_count <= p_grain) {
+		return 0;
+	}
+	// Aim for a few chunks per thread, so threads that finish early can take over pending work.
+	const uint32_t chunks_per_thread = 4;
+	uint32_t chunk_size = p_count / ((singleton->get_thread_count() + 1) * chunks_per_thread);
+	return MAX(chunk_size, p_grain);
+}
+
 int WorkerThreadPool::get_thread_index() const {
 	Thread::ID tid = Thread::get_caller_id();
 	return thread_ids.has(tid) ? thread_ids[tid] : -1;
@@ -776,8 +1072,9 @@ int WorkerThreadPool::get_thread_index() const {
 
 WorkerThreadPool::TaskID WorkerThreadPool::get_caller_task_id() const {
 	int th_index = get_thread_index();
-	if (th_index != -1 && threads[th_index].current_task) {
-		return threads[th_index].current_task->self;
+	const Task *current_task = th_index != -1 ? threads[th_index].current_task.load(std::memory_order_relaxed) : nullptr;
+	if (current_task) {
+		return current_task->self;
 	} else {
 		return INVALID_TASK_ID;
 	}
@@ -785,8 +1082,9 @@ WorkerThreadPool::TaskID WorkerThreadPool::get_caller_task_id() const {
 
 WorkerThreadPool::GroupID WorkerThreadPool::get_caller_group_id() const {
 	int th_index = get_thread_index();
-	if (th_index != -1 && threads[th_index].current_task && threads[th_index].current_task->group) {
-		return threads[th_index].current_task->group->self;
+	const Task *current_task = th_index != -1 ? threads[th_index].current_task.load(std::memory_order_relaxed) : nullptr;
+	if (current_task && current_task->group) {
+		return current_task->group->self;
 	} else {
 		return INVALID_TASK_ID;
 	}
@@ -854,9 +1152,11 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 	for (uint32_t i = 0; i < threads.size(); i++) {
 		threads[i].index = i;
 		threads[i].pool = this;
+		threads[i].steal_seed = i + 1;
 		threads[i].thread.start(&WorkerThreadPool::_thread_function, &threads[i], settings);
 		thread_ids.insert(threads[i].thread.get_id(), i);
 	}
+	queue_thread_count.store(threads.size(), std::memory_order_release);
 }
 
 void WorkerThreadPool::exit_languages_threads() {
@@ -906,13 +1206,16 @@ void WorkerThreadPool::finish() {
 		}
 	}
 
+	queue_thread_count.store(0, std::memory_order_release);
 	threads.clear();
 }
 
 void WorkerThreadPool::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("add_task", "action", "high_priority", "description"), &WorkerThreadPool::add_task_bind, DEFVAL(false), DEFVAL(String()));
+	ClassDB::bind_method(D_METHOD("add_dependent_task", "action", "dependencies", "high_priority", "description"), &WorkerThreadPool::add_dependent_task, DEFVAL(false), DEFVAL(String()));
 	ClassDB::bind_method(D_METHOD("is_task_completed", "task_id"), &WorkerThreadPool::is_task_completed);
 	ClassDB::bind_method(D_METHOD("wait_for_task_completion", "task_id"), &WorkerThreadPool::wait_for_task_completion);
+	ClassDB::bind_method(D_METHOD("wait_for_task_graph_completion", "ids"), &WorkerThreadPool::wait_for_task_graph_completion);
 	ClassDB::bind_method(D_METHOD("get_caller_task_id"), &WorkerThreadPool::get_caller_task_id);
 
 	ClassDB::bind_method(D_METHOD("add_group_task", "action", "elements", "tasks_needed", "high_priority", "description"), &WorkerThreadPool::add_group_task, DEFVAL(-1), DEFVAL(false), DEFVAL(String()));
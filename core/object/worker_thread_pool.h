@@ -39,6 +39,9 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_deque.h"
+
+#include <atomic>
 
 class WorkerThreadPool : public Object {
 	GDCLASS(WorkerThreadPool, Object)
@@ -61,13 +64,24 @@ private:
 
 	struct Group {
 		GroupID self = -1;
-		SafeNumeric<uint32_t> index;
+		// One range of pending work indices per task, packed as (end << 32) | begin.
+		// Each task consumes its own range from the front and, once it's exhausted,
+		// steals the upper half of another task's range.
+		SafeNumeric<uint64_t> *ranges = nullptr;
+		uint32_t range_count = 0;
 		SafeNumeric<uint32_t> completed_index;
 		uint32_t max = 0;
 		Semaphore done_semaphore;
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		LocalVector<Task *> dependents; // Tasks to be posted once this group completes.
+
+		~Group() {
+			if (ranges) {
+				memdelete_arr(ranges);
+			}
+		}
 	};
 
 	struct Task {
@@ -79,20 +93,23 @@ private:
 		String description;
 		Semaphore done_semaphore; // For user threads awaiting.
 		bool completed : 1;
-		bool pending_notify_yield_over : 1;
 		bool is_pump_task : 1;
+		std::atomic<bool> pending_notify_yield_over = false;
 		Group *group = nullptr;
+		uint32_t group_range = 0;
 		SelfList<Task> task_elem;
 		uint32_t waiting_pool = 0;
 		uint32_t waiting_user = 0;
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
-		int pool_thread_index = -1;
+		std::atomic<int> pool_thread_index = -1; // Set by the thread that starts the task, without the lock.
+		int queue_thread_index = -1; // Thread whose local queue the task was pushed to, if any.
+		uint32_t pending_dependencies = 0; // The task is only posted when this reaches zero.
+		LocalVector<Task *> dependents; // Tasks to be posted once this one completes.
 
 		void free_template_userdata();
 		Task() :
 				completed(false),
-				pending_notify_yield_over(false),
 				is_pump_task(false),
 				task_elem(this) {}
 	};
@@ -117,9 +134,11 @@ private:
 		bool yield_is_over : 1;
 		bool pre_exited_languages : 1;
 		bool exited_languages : 1;
-		bool has_pump_task : 1; // Threads can only have one pump task.
-		Task *current_task = nullptr;
+		bool has_pump_task = false; // Threads can only have one pump task. Only accessed by the thread itself.
+		std::atomic<Task *> current_task = nullptr; // Written by the thread itself without the lock, read by others with it.
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
+		WorkStealingDeque<Task *> local_queue; // Tasks posted from this thread. Popped LIFO by the owner, stolen FIFO by others, all without the lock.
+		uint32_t steal_seed = 1; // Only accessed by the thread itself.
 		ConditionVariable cond_var;
 		WorkerThreadPool *pool = nullptr;
 
@@ -127,8 +146,7 @@ private:
 				signaled(false),
 				yield_is_over(false),
 				pre_exited_languages(false),
-				exited_languages(false),
-				has_pump_task(false) {}
+				exited_languages(false) {}
 	};
 
 	TightLocalVector<ThreadData> threads;
@@ -167,6 +185,8 @@ private:
 	uint32_t max_low_priority_threads = 0;
 	uint32_t low_priority_threads_used = 0;
 	uint32_t notify_index = 0; // For rotating across threads, no help distributing load.
+	std::atomic<uint32_t> queue_thread_count = 0; // Threads whose local queues are ready to be stolen from.
+	std::atomic<uint32_t> sleeping_threads = 0; // Threads waiting on their condition variable, or about to.
 
 	uint64_t last_task = 1;
 	int pump_task_count = 0;
@@ -177,11 +197,28 @@ private:
 
 	void _process_task(Task *task);
 
-	void _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock, bool p_pump_task);
+	// Tasks that must go to the local queue of the calling thread are moved to the front of p_tasks and counted in the
+	// return value. The caller pushes them with _push_local_tasks() once it has released the lock.
+	uint32_t _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock, bool p_pump_task);
+	void _push_local_tasks(Task **p_tasks, uint32_t p_count);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
 	bool _try_promote_low_priority_task();
 
+	void _release_dependents(LocalVector<Task *> &p_dependents, LocalVector<Task *> &r_ready);
+	void _post_ready_dependents(LocalVector<Task *> &p_ready);
+
+	bool _has_local_tasks() const;
+	_FORCE_INLINE_ bool _has_queued_tasks() const { return task_queue.first() || _has_local_tasks(); }
+	Task *_steal_task(ThreadData *p_thread_data);
+	Task *_pop_local_task(ThreadData *p_thread_data);
+	Task *_pop_task(ThreadData *p_thread_data, bool p_allow_pump_task);
+	void _wait_for_tasks(ThreadData *p_thread_data, MutexLock<BinaryMutex> &p_lock);
+	// Takes a high priority task back if no thread has started it yet. Tasks in a local queue can only be taken back by
+	// the thread owning it, and only from the newest end, so cancel them in reverse order of posting.
+	bool _try_cancel_task(TaskID p_task_id);
+	static bool _claim_group_work_index(Group *p_group, uint32_t p_range, uint32_t &r_index);
+
 	static WorkerThreadPool *singleton;
 
 #ifdef THREADS_ENABLED
@@ -193,7 +230,7 @@ private:
 	static thread_local UnlockableLocks unlockable_locks[MAX_UNLOCKABLE_LOCKS];
 #endif
 
-	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task = false);
+	TaskID _add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task = false, Span<TaskID> p_dependencies = Span<TaskID>());
 	GroupID _add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description);
 
 	template <typename C, typename M, typename U>
@@ -216,6 +253,60 @@ private:
 		}
 	};
 
+	template <typename F>
+	struct ParallelForUserdata {
+		F *func = nullptr;
+		uint32_t begin = 0;
+		uint32_t end = 0;
+		uint32_t chunk_size = 0;
+		uint32_t chunk_count = 0;
+		SafeNumeric<uint32_t> next_chunk;
+
+		void process() {
+			uint32_t chunk = next_chunk.postincrement();
+			while (chunk < chunk_count) {
+				uint32_t from = begin + chunk * chunk_size;
+				uint32_t to = MIN((uint64_t)from + chunk_size, (uint64_t)end);
+				(*func)(chunk, from, to);
+				chunk = next_chunk.postincrement();
+			}
+		}
+
+		static void process_task(void *p_userdata) {
+			((ParallelForUserdata *)p_userdata)->process();
+		}
+	};
+
+	// Returns how many elements each chunk should have, or zero if the range is better processed serially.
+	static uint32_t _get_parallel_chunk_size(uint32_t p_count, uint32_t p_grain);
+
+	// Chunks are claimed dynamically by helper tasks and by the calling thread itself, so this never
+	// blocks a pool thread waiting for work no one else can pick up, and nested calls are safe.
+	template <typename F>
+	static void _parallel_for_chunks(uint32_t p_begin, uint32_t p_end, uint32_t p_chunk_size, F &p_func, const String &p_description) {
+		ParallelForUserdata<F> ud;
+		ud.func = &p_func;
+		ud.begin = p_begin;
+		ud.end = p_end;
+		ud.chunk_size = p_chunk_size;
+		ud.chunk_count = ((uint64_t)p_end - p_begin + p_chunk_size - 1) / p_chunk_size;
+
+		uint32_t helper_count = MIN(ud.chunk_count - 1, (uint32_t)singleton->get_thread_count());
+		TaskID *helpers = (TaskID *)alloca(sizeof(TaskID) * helper_count);
+		for (uint32_t i = 0; i < helper_count; i++) {
+			helpers[i] = singleton->add_native_task(&ParallelForUserdata<F>::process_task, &ud, true, p_description);
+		}
+
+		ud.process();
+
+		// All chunks are claimed by now. Helpers still queued have nothing left to do, so only wait for the ones that started.
+		for (uint32_t i = helper_count; i-- > 0;) {
+			if (!singleton->_try_cancel_task(helpers[i])) {
+				singleton->wait_for_task_completion(helpers[i]);
+			}
+		}
+	}
+
 	void _wait_collaboratively(ThreadData *p_caller_pool_thread, Task *p_task);
 
 	void _switch_runlevel(Runlevel p_runlevel);
@@ -245,8 +336,22 @@ public:
 	TaskID add_task(const Callable &p_action, bool p_high_priority = false, const String &p_description = String(), bool p_pump_task = false);
 	TaskID add_task_bind(const Callable &p_action, bool p_high_priority = false, const String &p_description = String());
 
+	// Dependent tasks are only posted once all the tasks and groups in p_dependencies have completed.
+	template <typename C, typename M, typename U>
+	TaskID add_dependent_template_task(C *p_instance, M p_method, U p_userdata, Span<TaskID> p_dependencies, bool p_high_priority = false, const String &p_description = String()) {
+		typedef TaskUserData<C, M, U> TUD;
+		TUD *ud = memnew(TUD);
+		ud->instance = p_instance;
+		ud->method = p_method;
+		ud->userdata = p_userdata;
+		return _add_task(Callable(), nullptr, nullptr, ud, p_high_priority, p_description, false, p_dependencies);
+	}
+	TaskID add_dependent_native_task(void (*p_func)(void *), void *p_userdata, Span<TaskID> p_dependencies, bool p_high_priority = false, const String &p_description = String());
+	TaskID add_dependent_task(const Callable &p_action, const Vector<TaskID> &p_dependencies, bool p_high_priority = false, const String &p_description = String());
+
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
+	Error wait_for_task_graph_completion(const Vector<TaskID> &p_ids);
 
 	void yield();
 	void notify_yield_over(TaskID p_task_id);
@@ -266,6 +371,73 @@ public:
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
 
+	// Runs p_func(from, to) over consecutive sub-ranges of [p_begin, p_end) on the main pool and returns when all are done.
+	// Sub-ranges have at least p_grain elements and are made smaller than an even split, so uneven work gets balanced.
+	// Falls back to a single call on the calling thread when the range is too small or there are no worker threads.
+	template <typename F>
+	static void parallel_for_range(uint32_t p_begin, uint32_t p_end, uint32_t p_grain, F &&p_func, const String &p_description = String()) {
+		if (p_begin >= p_end) {
+			return;
+		}
+		uint32_t chunk_size = _get_parallel_chunk_size(p_end - p_begin, p_grain);
+		if (chunk_size == 0) {
+			p_func(p_begin, p_end);
+			return;
+		}
+		auto chunk_func = [&p_func](uint32_t p_chunk, uint32_t p_from, uint32_t p_to) {
+			p_func(p_from, p_to);
+		};
+		_parallel_for_chunks(p_begin, p_end, chunk_size, chunk_func, p_description);
+	}
+
+	// Same as parallel_for_range(), but calls p_func(index) for each index.
+	template <typename F>
+	static void parallel_for(uint32_t p_begin, uint32_t p_end, uint32_t p_grain, F &&p_func, const String &p_description = String()) {
+		parallel_for_range(
+				p_begin, p_end, p_grain, [&p_func](uint32_t p_from, uint32_t p_to) {
+					for (uint32_t i = p_from; i < p_to; i++) {
+						p_func(i);
+					}
+				},
+				p_description);
+	}
+
+	// Calls p_func(index, accumulator) for each index, with one accumulator per chunk starting at p_identity,
+	// then combines them with p_reduce(a, b) in chunk order, so the result doesn't depend on scheduling.
+	template <typename T, typename F, typename R>
+	static T parallel_reduce(uint32_t p_begin, uint32_t p_end, uint32_t p_grain, const T &p_identity, F &&p_func, R &&p_reduce, const String &p_description = String()) {
+		T result = p_identity;
+		if (p_begin >= p_end) {
+			return result;
+		}
+		uint32_t chunk_size = _get_parallel_chunk_size(p_end - p_begin, p_grain);
+		if (chunk_size == 0) {
+			for (uint32_t i = p_begin; i < p_end; i++) {
+				p_func(i, result);
+			}
+			return result;
+		}
+
+		uint32_t chunk_count = ((uint64_t)p_end - p_begin + chunk_size - 1) / chunk_size;
+		LocalVector<T> partials;
+		partials.resize(chunk_count);
+		for (T &partial : partials) {
+			partial = p_identity;
+		}
+		auto chunk_func = [&p_func, &partials](uint32_t p_chunk, uint32_t p_from, uint32_t p_to) {
+			T &partial = partials[p_chunk];
+			for (uint32_t i = p_from; i < p_to; i++) {
+				p_func(i, partial);
+			}
+		};
+		_parallel_for_chunks(p_begin, p_end, chunk_size, chunk_func, p_description);
+
+		for (const T &partial : partials) {
+			result = p_reduce(result, partial);
+		}
+		return result;
+	}
+
 	_FORCE_INLINE_ int get_thread_count() const {
 #ifdef THREADS_ENABLED
 		return threads.size();
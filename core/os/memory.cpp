@@ -32,8 +32,47 @@
 
 #include "core/templates/safe_refcount.h"
 
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+#include "core/os/small_object_allocator.h"
+#endif
+
 #include <cstdlib>
 
+// Heap functions backing the static allocator, replaced when built with `small_object_allocator=yes`.
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+static _FORCE_INLINE_ void *_memory_malloc(size_t p_bytes) {
+	return SmallObjectAllocator::alloc(p_bytes);
+}
+
+static _FORCE_INLINE_ void *_memory_calloc(size_t p_bytes) {
+	return SmallObjectAllocator::alloc_zeroed(p_bytes);
+}
+
+static _FORCE_INLINE_ void *_memory_realloc(void *p_memory, size_t p_bytes) {
+	return SmallObjectAllocator::realloc(p_memory, p_bytes);
+}
+
+static _FORCE_INLINE_ void _memory_free(void *p_memory) {
+	SmallObjectAllocator::free(p_memory);
+}
+#else
+static _FORCE_INLINE_ void *_memory_malloc(size_t p_bytes) {
+	return malloc(p_bytes);
+}
+
+static _FORCE_INLINE_ void *_memory_calloc(size_t p_bytes) {
+	return calloc(1, p_bytes);
+}
+
+static _FORCE_INLINE_ void *_memory_realloc(void *p_memory, size_t p_bytes) {
+	return realloc(p_memory, p_bytes);
+}
+
+static _FORCE_INLINE_ void _memory_free(void *p_memory) {
+	free(p_memory);
+}
+#endif
+
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
 }
@@ -59,6 +98,8 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+thread_local uint64_t Memory::pool_hits = 0;
+thread_local uint64_t Memory::pool_misses = 0;
 #endif
 
 void *Memory::alloc_aligned_static(size_t p_bytes, size_t p_alignment) {
@@ -103,9 +144,9 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 
 	void *mem;
 	if constexpr (p_ensure_zero) {
-		mem = calloc(1, p_bytes + (prepad ? DATA_OFFSET : 0));
+		mem = _memory_calloc(p_bytes + (prepad ? DATA_OFFSET : 0));
 	} else {
-		mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+		mem = _memory_malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
 	}
 
 	ERR_FAIL_NULL_V(mem, nullptr);
@@ -156,12 +197,12 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 #endif
 
 		if (p_bytes == 0) {
-			free(mem);
+			_memory_free(mem);
 			return nullptr;
 		} else {
 			*s = p_bytes;
 
-			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
+			mem = (uint8_t *)_memory_realloc(mem, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
@@ -171,7 +212,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 			return mem + DATA_OFFSET;
 		}
 	} else {
-		mem = (uint8_t *)realloc(mem, p_bytes);
+		mem = (uint8_t *)_memory_realloc(mem, p_bytes);
 
 		ERR_FAIL_COND_V(mem == nullptr && p_bytes > 0, nullptr);
 
@@ -198,9 +239,9 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 		mem_usage.sub(*s);
 #endif
 
-		free(mem);
+		_memory_free(mem);
 	} else {
-		free(mem);
+		_memory_free(mem);
 	}
 }
 
@@ -211,6 +252,8 @@ uint64_t Memory::get_mem_available() {
 uint64_t Memory::get_mem_usage() {
 #ifdef DEBUG_ENABLED
 	return mem_usage.get();
+#elif defined(SMALL_OBJECT_ALLOCATOR_ENABLED)
+	return SmallObjectAllocator::get_stats().live_bytes;
 #else
 	return 0;
 #endif
@@ -219,6 +262,32 @@ uint64_t Memory::get_mem_usage() {
 uint64_t Memory::get_mem_max_usage() {
 #ifdef DEBUG_ENABLED
 	return max_usage.get();
+#elif defined(SMALL_OBJECT_ALLOCATOR_ENABLED)
+	return SmallObjectAllocator::get_stats().max_live_bytes;
+#else
+	return 0;
+#endif
+}
+
+double Memory::get_mem_fragmentation() {
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+	return SmallObjectAllocator::get_fragmentation();
+#else
+	return 0.0;
+#endif
+}
+
+uint64_t Memory::get_pool_hit_count() {
+#ifdef DEBUG_ENABLED
+	return pool_hits;
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_pool_miss_count() {
+#ifdef DEBUG_ENABLED
+	return pool_misses;
 #else
 	return 0;
 #endif
@@ -40,6 +40,9 @@ class Memory {
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
+	// Per thread, so pooled allocations never touch a shared cache line.
+	static thread_local uint64_t pool_hits;
+	static thread_local uint64_t pool_misses;
 #endif
 
 public:
@@ -87,6 +90,22 @@ public:
 	static uint64_t get_mem_available();
 	static uint64_t get_mem_usage();
 	static uint64_t get_mem_max_usage();
+	static double get_mem_fragmentation();
+
+	// Allocations served from (hits) or missing (misses) a thread local pool cache, see ThreadLocalPool.
+	// Counted for the calling thread only.
+	_FORCE_INLINE_ static void _record_pool_hit() {
+#ifdef DEBUG_ENABLED
+		pool_hits++;
+#endif
+	}
+	_FORCE_INLINE_ static void _record_pool_miss() {
+#ifdef DEBUG_ENABLED
+		pool_misses++;
+#endif
+	}
+	static uint64_t get_pool_hit_count();
+	static uint64_t get_pool_miss_count();
 };
 
 class DefaultAllocator {
@@ -389,6 +389,10 @@ uint64_t OS::get_static_memory_peak_usage() const {
 	return Memory::get_mem_max_usage();
 }
 
+double OS::get_static_memory_fragmentation() const {
+	return Memory::get_mem_fragmentation();
+}
+
 Error OS::set_cwd(const String &p_cwd) {
 	return ERR_CANT_OPEN;
 }
@@ -276,6 +276,7 @@ public:
 
 	virtual uint64_t get_static_memory_usage() const;
 	virtual uint64_t get_static_memory_peak_usage() const;
+	virtual double get_static_memory_fragmentation() const;
 	virtual Dictionary get_memory_info() const;
 
 	bool is_separate_thread_rendering_enabled() const { return _separate_thread_render; }
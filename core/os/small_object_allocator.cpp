@@ -0,0 +1,396 @@
+/**************************************************************************/
+/*  small_object_allocator.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "small_object_allocator.h"
+
+#include "core/os/spin_lock.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(WINDOWS_ENABLED)
+#include <windows.h>
+#elif defined(UNIX_ENABLED) && !defined(WEB_ENABLED)
+#include <sys/mman.h>
+#define SMALL_OBJECT_ALLOCATOR_MMAP
+#endif
+
+static constexpr uint32_t CLASS_COUNT = 16;
+static constexpr uint32_t CLASS_SIZES[CLASS_COUNT] = { 16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512 };
+// Size class of a request, indexed by its size in 16 byte units, rounded up.
+static constexpr uint8_t CLASS_LOOKUP[SmallObjectAllocator::MAX_SIZE / 16 + 1] = {
+	0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 9, 10, 10, 11, 11,
+	12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15
+};
+
+// Blocks moved between a thread and the global pool at once, roughly one page worth.
+static constexpr uint32_t get_batch_size(uint32_t p_class) {
+	return CLAMP(4096 / CLASS_SIZES[p_class], 8u, 64u);
+}
+
+// Address space reserved for slabs. Only committed slabs use memory.
+static constexpr uint64_t RESERVE_SIZE = uint64_t(32) * 1024 * 1024 * 1024;
+static constexpr uint32_t SLAB_SHIFT = 21;
+static constexpr uint32_t SLAB_COUNT = RESERVE_SIZE >> SLAB_SHIFT;
+static_assert((size_t(1) << SLAB_SHIFT) == SmallObjectAllocator::SLAB_SIZE);
+
+enum RegionState : uint32_t {
+	REGION_UNINITIALIZED,
+	REGION_READY,
+	REGION_UNAVAILABLE,
+};
+
+static std::atomic<uintptr_t> region_base = 0;
+static std::atomic<uint32_t> region_state = REGION_UNINITIALIZED;
+static SpinLock region_lock;
+static uint32_t slabs_used = 0;
+static uint8_t slab_classes[SLAB_COUNT];
+
+static std::atomic<int64_t> live_bytes = 0;
+static std::atomic<int64_t> max_live_bytes = 0;
+static std::atomic<uint64_t> pooled_bytes = 0;
+
+// Free blocks are linked through their first word. Blocks in the global pool
+// are kept in chains of exactly one batch, linked through their second word,
+// so a thread can take or return a whole batch in constant time under the lock.
+// Blocks returned one by one (at thread exit) go to the loose list instead.
+struct SizeClass {
+	SpinLock lock;
+	void *batches = nullptr;
+	void *loose = nullptr;
+	uint8_t *bump = nullptr;
+	uint8_t *bump_end = nullptr;
+};
+
+static SizeClass size_classes[CLASS_COUNT];
+
+static _FORCE_INLINE_ void *&next_block(void *p_block) {
+	return *(void **)p_block;
+}
+
+static _FORCE_INLINE_ void *&next_batch(void *p_block) {
+	return ((void **)p_block)[1];
+}
+
+static uint8_t *reserve_region() {
+	uint8_t *mem = nullptr;
+#if defined(WINDOWS_ENABLED)
+	const size_t size = RESERVE_SIZE + SmallObjectAllocator::SLAB_SIZE; // Room to align the base to a slab.
+	mem = (uint8_t *)VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#elif defined(SMALL_OBJECT_ALLOCATOR_MMAP)
+	const size_t size = RESERVE_SIZE + SmallObjectAllocator::SLAB_SIZE; // Room to align the base to a slab.
+	int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+	flags |= MAP_NORESERVE;
+#endif
+	void *res = mmap(nullptr, size, PROT_NONE, flags, -1, 0);
+	mem = res == MAP_FAILED ? nullptr : (uint8_t *)res;
+#endif
+	if (!mem) {
+		return nullptr;
+	}
+	return (uint8_t *)(((uintptr_t)mem + SmallObjectAllocator::SLAB_SIZE - 1) & ~uintptr_t(SmallObjectAllocator::SLAB_SIZE - 1));
+}
+
+static bool commit_slab(uint8_t *p_slab) {
+#if defined(WINDOWS_ENABLED)
+	return VirtualAlloc(p_slab, SmallObjectAllocator::SLAB_SIZE, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#elif defined(SMALL_OBJECT_ALLOCATOR_MMAP)
+	if (mprotect(p_slab, SmallObjectAllocator::SLAB_SIZE, PROT_READ | PROT_WRITE) != 0) {
+		return false;
+	}
+#ifdef MADV_HUGEPAGE
+	// Slabs are aligned to the huge page size, so they can be backed by a single TLB entry.
+	madvise(p_slab, SmallObjectAllocator::SLAB_SIZE, MADV_HUGEPAGE);
+#endif
+	return true;
+#else
+	return false;
+#endif
+}
+
+// Returns a fresh slab for the given class, or nullptr when the region is full or unavailable.
+static uint8_t *alloc_slab(uint32_t p_class) {
+	if (sizeof(void *) < 8) {
+		return nullptr; // Not worth reserving a region in a 32-bit address space.
+	}
+
+	region_lock.lock();
+	if (region_state.load(std::memory_order_relaxed) == REGION_UNINITIALIZED) {
+		uint8_t *base = reserve_region();
+		region_base.store((uintptr_t)base, std::memory_order_release);
+		region_state.store(base ? REGION_READY : REGION_UNAVAILABLE, std::memory_order_relaxed);
+	}
+
+	uint8_t *slab = nullptr;
+	if (region_state.load(std::memory_order_relaxed) == REGION_READY && slabs_used < SLAB_COUNT) {
+		slab = (uint8_t *)region_base.load(std::memory_order_relaxed) + (size_t(slabs_used) << SLAB_SHIFT);
+		if (commit_slab(slab)) {
+			slab_classes[slabs_used] = p_class;
+			slabs_used++;
+		} else {
+			slab = nullptr;
+		}
+	}
+	region_lock.unlock();
+	return slab;
+}
+
+static _FORCE_INLINE_ uint32_t get_block_class(const void *p_block) {
+	return slab_classes[((uintptr_t)p_block - region_base.load(std::memory_order_relaxed)) >> SLAB_SHIFT];
+}
+
+static void report_live_bytes(int64_t &r_delta) {
+	if (r_delta == 0) {
+		return;
+	}
+	int64_t live = live_bytes.fetch_add(r_delta, std::memory_order_relaxed) + r_delta;
+	r_delta = 0;
+	int64_t max_live = max_live_bytes.load(std::memory_order_relaxed);
+	while (live > max_live && !max_live_bytes.compare_exchange_weak(max_live, live, std::memory_order_relaxed)) {
+	}
+}
+
+struct ThreadCache {
+	struct Bin {
+		void *head = nullptr;
+		uint32_t count = 0;
+	};
+
+	Bin bins[CLASS_COUNT];
+	int64_t live_delta = 0;
+	bool destroyed = false;
+
+	// Detaches one batch from the head of the bin, which must hold at least that many blocks.
+	void *pop_batch(uint32_t p_class) {
+		Bin &bin = bins[p_class];
+		const uint32_t batch_size = get_batch_size(p_class);
+		void *first = bin.head;
+		void *last = first;
+		for (uint32_t i = 1; i < batch_size; i++) {
+			last = next_block(last);
+		}
+		bin.head = next_block(last);
+		bin.count -= batch_size;
+		next_block(last) = nullptr;
+		return first;
+	}
+
+	bool refill(uint32_t p_class) {
+		if (unlikely(destroyed)) {
+			return false;
+		}
+		report_live_bytes(live_delta);
+
+		SizeClass &size_class = size_classes[p_class];
+		const uint32_t batch_size = get_batch_size(p_class);
+		const uint32_t block_size = CLASS_SIZES[p_class];
+		Bin &bin = bins[p_class];
+
+		size_class.lock.lock();
+		if (size_class.batches) {
+			bin.head = size_class.batches;
+			bin.count = batch_size;
+			size_class.batches = next_batch(bin.head);
+		} else if (size_class.loose) {
+			void *last = size_class.loose;
+			uint32_t count = 1;
+			while (count < batch_size && next_block(last)) {
+				last = next_block(last);
+				count++;
+			}
+			bin.head = size_class.loose;
+			bin.count = count;
+			size_class.loose = next_block(last);
+			next_block(last) = nullptr;
+		} else {
+			if (size_t(size_class.bump_end - size_class.bump) < block_size) {
+				uint8_t *slab = alloc_slab(p_class);
+				if (!slab) {
+					size_class.lock.unlock();
+					return false;
+				}
+				size_class.bump = slab;
+				size_class.bump_end = slab + SmallObjectAllocator::SLAB_SIZE;
+			}
+			const uint32_t count = MIN(batch_size, uint32_t((size_class.bump_end - size_class.bump) / block_size));
+			uint8_t *blocks = size_class.bump;
+			size_class.bump += count * block_size;
+			for (uint32_t i = 0; i < count - 1; i++) {
+				next_block(blocks + i * block_size) = blocks + (i + 1) * block_size;
+			}
+			next_block(blocks + (count - 1) * block_size) = nullptr;
+			bin.head = blocks;
+			bin.count = count;
+			pooled_bytes.fetch_add(count * block_size, std::memory_order_relaxed);
+		}
+		size_class.lock.unlock();
+		return true;
+	}
+
+	void release_batch(uint32_t p_class) {
+		void *batch = pop_batch(p_class);
+		SizeClass &size_class = size_classes[p_class];
+		size_class.lock.lock();
+		next_batch(batch) = size_class.batches;
+		size_class.batches = batch;
+		size_class.lock.unlock();
+		report_live_bytes(live_delta);
+	}
+
+	~ThreadCache() {
+		for (uint32_t i = 0; i < CLASS_COUNT; i++) {
+			while (bins[i].count >= get_batch_size(i)) {
+				release_batch(i);
+			}
+			if (bins[i].head) {
+				void *last = bins[i].head;
+				while (next_block(last)) {
+					last = next_block(last);
+				}
+				SizeClass &size_class = size_classes[i];
+				size_class.lock.lock();
+				next_block(last) = size_class.loose;
+				size_class.loose = bins[i].head;
+				size_class.lock.unlock();
+				bins[i].head = nullptr;
+				bins[i].count = 0;
+			}
+		}
+		report_live_bytes(live_delta);
+		// Blocks freed by thread local destructors that run after this one go straight to the global pool.
+		destroyed = true;
+	}
+};
+
+static thread_local ThreadCache thread_cache;
+
+void *SmallObjectAllocator::alloc(size_t p_bytes) {
+	if (unlikely(p_bytes == 0 || p_bytes > MAX_SIZE)) {
+		return ::malloc(p_bytes);
+	}
+	const uint32_t block_class = CLASS_LOOKUP[(p_bytes + 15) >> 4];
+	ThreadCache &cache = thread_cache;
+	ThreadCache::Bin &bin = cache.bins[block_class];
+	if (unlikely(!bin.head) && !cache.refill(block_class)) {
+		return ::malloc(p_bytes);
+	}
+	void *block = bin.head;
+	bin.head = next_block(block);
+	bin.count--;
+	cache.live_delta += CLASS_SIZES[block_class];
+	return block;
+}
+
+void *SmallObjectAllocator::alloc_zeroed(size_t p_bytes) {
+	if (unlikely(p_bytes == 0 || p_bytes > MAX_SIZE)) {
+		return ::calloc(1, p_bytes);
+	}
+	void *mem = alloc(p_bytes);
+	if (mem) {
+		memset(mem, 0, p_bytes);
+	}
+	return mem;
+}
+
+void *SmallObjectAllocator::realloc(void *p_memory, size_t p_bytes) {
+	if (!owns(p_memory)) {
+		return ::realloc(p_memory, p_bytes);
+	}
+	const size_t block_size = CLASS_SIZES[get_block_class(p_memory)];
+	if (p_bytes > 0 && p_bytes <= block_size) {
+		return p_memory;
+	}
+	void *mem = nullptr;
+	if (p_bytes > 0) {
+		mem = alloc(p_bytes);
+		if (!mem) {
+			return nullptr;
+		}
+		memcpy(mem, p_memory, MIN(p_bytes, block_size));
+	}
+	free(p_memory);
+	return mem;
+}
+
+void SmallObjectAllocator::free(void *p_memory) {
+	if (!owns(p_memory)) {
+		::free(p_memory);
+		return;
+	}
+	const uint32_t block_class = get_block_class(p_memory);
+	ThreadCache &cache = thread_cache;
+	if (unlikely(cache.destroyed)) {
+		SizeClass &size_class = size_classes[block_class];
+		size_class.lock.lock();
+		next_block(p_memory) = size_class.loose;
+		size_class.loose = p_memory;
+		size_class.lock.unlock();
+		live_bytes.fetch_sub(CLASS_SIZES[block_class], std::memory_order_relaxed);
+		return;
+	}
+	ThreadCache::Bin &bin = cache.bins[block_class];
+	next_block(p_memory) = bin.head;
+	bin.head = p_memory;
+	bin.count++;
+	cache.live_delta -= CLASS_SIZES[block_class];
+	if (unlikely(bin.count >= 2 * get_batch_size(block_class))) {
+		cache.release_batch(block_class);
+	}
+}
+
+bool SmallObjectAllocator::owns(const void *p_memory) {
+	const uintptr_t base = region_base.load(std::memory_order_relaxed);
+	return base && (uintptr_t)p_memory - base < RESERVE_SIZE;
+}
+
+size_t SmallObjectAllocator::get_block_size(const void *p_memory) {
+	return owns(p_memory) ? CLASS_SIZES[get_block_class(p_memory)] : 0;
+}
+
+SmallObjectAllocator::Stats SmallObjectAllocator::get_stats() {
+	Stats stats;
+	stats.live_bytes = MAX(live_bytes.load(std::memory_order_relaxed), int64_t(0));
+	stats.max_live_bytes = MAX(max_live_bytes.load(std::memory_order_relaxed), int64_t(0));
+	stats.pooled_bytes = pooled_bytes.load(std::memory_order_relaxed);
+	region_lock.lock();
+	stats.committed_bytes = uint64_t(slabs_used) * SLAB_SIZE;
+	region_lock.unlock();
+	return stats;
+}
+
+double SmallObjectAllocator::get_fragmentation() {
+	const Stats stats = get_stats();
+	if (stats.pooled_bytes == 0) {
+		return 0.0;
+	}
+	return 1.0 - MIN(double(stats.live_bytes) / double(stats.pooled_bytes), 1.0);
+}
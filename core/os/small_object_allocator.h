@@ -0,0 +1,70 @@
+/**************************************************************************/
+/*  small_object_allocator.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/typedefs.h"
+
+// Thread caching allocator for small blocks, used by Memory when the engine is
+// built with `small_object_allocator=yes`.
+//
+// Requests of up to MAX_SIZE bytes are rounded up to one of a few size classes
+// and served from per-thread free lists, without locking. Threads exchange
+// blocks with a global pool in batches. The global pool carves blocks out of
+// 2 MiB slabs committed from a single reserved address range, which lets
+// free() tell pooled blocks apart from heap blocks with a range check, and
+// lets the OS back slabs with huge pages where it supports it.
+//
+// Larger requests, and all requests on platforms where the address range
+// can't be reserved, are forwarded to malloc().
+class SmallObjectAllocator {
+public:
+	static constexpr size_t MAX_SIZE = 512;
+	static constexpr size_t SLAB_SIZE = 2 * 1024 * 1024;
+
+	struct Stats {
+		uint64_t live_bytes = 0; // Bytes in blocks handed out to callers, rounded to their size class. Threads report their usage in batches.
+		uint64_t max_live_bytes = 0;
+		uint64_t pooled_bytes = 0; // Bytes carved out of slabs, both live and cached.
+		uint64_t committed_bytes = 0; // Bytes of committed slabs.
+	};
+
+	static void *alloc(size_t p_bytes);
+	static void *alloc_zeroed(size_t p_bytes);
+	static void *realloc(void *p_memory, size_t p_bytes);
+	static void free(void *p_memory);
+
+	static bool owns(const void *p_memory);
+	static size_t get_block_size(const void *p_memory);
+
+	static Stats get_stats();
+	// Share of pooled bytes not currently handed out to callers, between 0 and 1.
+	static double get_fragmentation();
+};
@@ -39,9 +39,23 @@ struct StringName::Table {
 	constexpr static uint32_t TABLE_LEN = 1 << TABLE_BITS;
 	constexpr static uint32_t TABLE_MASK = TABLE_LEN - 1;
 
+	// Buckets are guarded by one of several mutexes, so threads creating
+	// unrelated names (e.g. while loading resources) don't contend.
+	constexpr static uint32_t SHARD_BITS = 6;
+	constexpr static uint32_t SHARD_LEN = 1 << SHARD_BITS;
+	constexpr static uint32_t SHARD_MASK = SHARD_LEN - 1;
+
+	struct alignas(64) Shard {
+		BinaryMutex mutex;
+	};
+
 	static inline _Data *table[TABLE_LEN];
-	static inline BinaryMutex mutex;
-	static inline PagedAllocator<_Data> allocator;
+	static inline Shard shards[SHARD_LEN];
+	static inline PagedAllocator<_Data, true> allocator;
+
+	_FORCE_INLINE_ static BinaryMutex &get_mutex(uint32_t p_idx) {
+		return shards[p_idx & SHARD_MASK].mutex;
+	}
 };
 
 void StringName::setup() {
@@ -53,7 +67,9 @@ void StringName::setup() {
 }
 
 void StringName::cleanup() {
-	MutexLock lock(Table::mutex);
+	for (uint32_t i = 0; i < Table::SHARD_LEN; i++) {
+		Table::shards[i].mutex.lock();
+	}
 
 #ifdef DEBUG_ENABLED
 	if (unlikely(debug_stringname)) {
@@ -104,13 +120,18 @@ void StringName::cleanup() {
 		print_verbose(vformat("StringName: %d unclaimed string names at exit.", lost_strings));
 	}
 	configured = false;
+
+	for (uint32_t i = 0; i < Table::SHARD_LEN; i++) {
+		Table::shards[i].mutex.unlock();
+	}
 }
 
 void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(Table::mutex);
+		const uint32_t idx = _data->hash & Table::TABLE_MASK;
+		MutexLock lock(Table::get_mutex(idx));
 
 		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
 			ERR_PRINT("BUG: Unreferenced static string to 0: " + _data->name);
@@ -118,7 +139,6 @@ void StringName::unref() {
 		if (_data->prev) {
 			_data->prev->next = _data->next;
 		} else {
-			const uint32_t idx = _data->hash & Table::TABLE_MASK;
 			Table::table[idx] = _data->next;
 		}
 
@@ -213,7 +233,7 @@ StringName::StringName(const char *p_name, bool p_static) {
 	const uint32_t hash = String::hash(p_name);
 	const uint32_t idx = hash & Table::TABLE_MASK;
 
-	MutexLock lock(Table::mutex);
+	MutexLock lock(Table::get_mutex(idx));
 	_data = Table::table[idx];
 
 	while (_data) {
@@ -270,7 +290,7 @@ StringName::StringName(const String &p_name, bool p_static) {
 	const uint32_t hash = p_name.hash();
 	const uint32_t idx = hash & Table::TABLE_MASK;
 
-	MutexLock lock(Table::mutex);
+	MutexLock lock(Table::get_mutex(idx));
 	_data = Table::table[idx];
 
 	while (_data) {
@@ -31,7 +31,10 @@
 #include "command_queue_mt.h"
 
 CommandQueueMT::CommandQueueMT() {
-	command_mem.reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024);
+	// Spread the default reservation over the shards, busy ones grow on demand.
+	for (uint32_t i = 0; i < SHARD_COUNT; i++) {
+		shards[i].command_mem.reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024 / SHARD_COUNT);
+	}
 }
 
 CommandQueueMT::~CommandQueueMT() {
@@ -33,6 +33,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/condition_variable.h"
 #include "core/os/mutex.h"
+#include "core/os/thread.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/simple_type.h"
 #include "core/templates/tuple.h"
@@ -40,15 +41,11 @@
 
 class CommandQueueMT {
 	struct CommandBase {
-		bool sync = false;
 		virtual void call() = 0;
 		virtual ~CommandBase() = default;
-
-		CommandBase(bool p_sync) :
-				sync(p_sync) {}
 	};
 
-	template <typename T, typename M, bool NeedsSync, typename... Args>
+	template <typename T, typename M, typename... Args>
 	struct Command : public CommandBase {
 		T *instance;
 		M method;
@@ -56,7 +53,7 @@ class CommandQueueMT {
 
 		template <typename... FwdArgs>
 		_FORCE_INLINE_ Command(T *p_instance, M p_method, FwdArgs &&...p_args) :
-				CommandBase(NeedsSync), instance(p_instance), method(p_method), args(std::forward<FwdArgs>(p_args)...) {}
+				instance(p_instance), method(p_method), args(std::forward<FwdArgs>(p_args)...) {}
 
 		void call() {
 			call_impl(BuildIndexSequence<sizeof...(Args)>{});
@@ -83,7 +80,7 @@ class CommandQueueMT {
 		Tuple<GetSimpleTypeT<Args>...> args;
 
 		_FORCE_INLINE_ CommandRet(T *p_instance, M p_method, R *p_ret, GetSimpleTypeT<Args>... p_args) :
-				CommandBase(true), instance(p_instance), method(p_method), ret(p_ret), args{ p_args... } {}
+				instance(p_instance), method(p_method), ret(p_ret), args{ p_args... } {}
 
 		void call() override {
 			*ret = call_impl(BuildIndexSequence<sizeof...(Args)>{});
@@ -105,102 +102,177 @@ class CommandQueueMT {
 
 	static const uint32_t DEFAULT_COMMAND_MEM_SIZE_KB = 64;
 
-	BinaryMutex mutex;
-	LocalVector<uint8_t> command_mem;
+	// Producers are spread over several buffers by thread ID, so threads pushing at the same
+	// time don't contend on a single lock. All commands of a thread go to the same buffer,
+	// which keeps their order, and a global sequence number orders commands across buffers.
+	static const uint32_t SHARD_BITS = 4;
+	static const uint32_t SHARD_COUNT = 1 << SHARD_BITS;
+
+	struct CommandHeader {
+		uint64_t seq = 0;
+		uint64_t size = 0; // Aligned size of the command that follows.
+		bool *sync_done = nullptr; // Only set if the producer waits for the command.
+	};
+
+	struct alignas(64) Shard {
+		BinaryMutex mutex;
+		LocalVector<uint8_t> command_mem;
+	};
+
+	Shard shards[SHARD_COUNT];
+	std::atomic<uint64_t> next_seq{ 0 };
+
+	// Commands taken out of the shards, only touched by the flushing thread.
+	BinaryMutex flush_mutex;
+	LocalVector<uint8_t> flush_mem[SHARD_COUNT];
+	bool flushing = false;
+
+	BinaryMutex sync_mutex;
 	ConditionVariable sync_cond_var;
-	uint32_t sync_head = 0;
-	uint32_t sync_tail = 0;
-	uint32_t sync_awaiters = 0;
-	WorkerThreadPool::TaskID pump_task_id = WorkerThreadPool::INVALID_TASK_ID;
-	uint64_t flush_read_ptr = 0;
+	std::atomic<WorkerThreadPool::TaskID> pump_task_id{ WorkerThreadPool::INVALID_TASK_ID };
 	std::atomic<bool> pending{ false };
 
 	template <typename T, typename... Args>
-	_FORCE_INLINE_ void create_command(Args &&...p_args) {
+	_FORCE_INLINE_ void create_command(LocalVector<uint8_t> &r_command_mem, bool *p_sync_done, Args &&...p_args) {
 		// alloc size is size+T+safeguard
 		constexpr uint64_t alloc_size = ((sizeof(T) + 8U - 1U) & ~(8U - 1U));
 		static_assert(alloc_size < UINT32_MAX, "Type too large to fit in the command queue.");
-
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + sizeof(uint64_t));
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		void *cmd = &command_mem[size + sizeof(uint64_t)];
+		static_assert(sizeof(CommandHeader) % 8U == 0U, "Command header must keep commands aligned.");
+
+		uint64_t size = r_command_mem.size();
+		r_command_mem.resize(size + sizeof(CommandHeader) + alloc_size);
+		CommandHeader *header = reinterpret_cast<CommandHeader *>(&r_command_mem[size]);
+		header->seq = next_seq.fetch_add(1, std::memory_order_relaxed);
+		header->size = alloc_size;
+		header->sync_done = p_sync_done;
+		void *cmd = &r_command_mem[size + sizeof(CommandHeader)];
 		new (cmd) T(std::forward<Args>(p_args)...);
-		pending.store(true);
 	}
 
 	template <typename T, bool NeedsSync, typename... Args>
 	_FORCE_INLINE_ void _push_internal(Args &&...args) {
-		MutexLock mlock(mutex);
-		create_command<T>(std::forward<Args>(args)...);
+		bool sync_done = false;
+		{
+			Shard &shard = shards[Thread::get_caller_id() & (SHARD_COUNT - 1)];
+			MutexLock mlock(shard.mutex);
+			create_command<T>(shard.command_mem, NeedsSync ? &sync_done : nullptr, std::forward<Args>(args)...);
+		}
+		pending.store(true);
 
-		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {
-			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);
+		const WorkerThreadPool::TaskID pump_task = pump_task_id.load(std::memory_order_relaxed);
+		if (pump_task != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task);
 		}
 
 		if constexpr (NeedsSync) {
-			sync_tail++;
-			_wait_for_sync(mlock);
+			_wait_for_sync(sync_done);
+		}
+	}
+
+	// Takes the commands of all shards at once, so no command can run before
+	// another one that was pushed before it, even from a different thread.
+	bool _take_commands() {
+		pending.store(false);
+
+		for (uint32_t i = 0; i < SHARD_COUNT; i++) {
+			shards[i].mutex.lock();
+		}
+		bool has_commands = false;
+		for (uint32_t i = 0; i < SHARD_COUNT; i++) {
+			if (!shards[i].command_mem.is_empty()) {
+				SWAP(shards[i].command_mem, flush_mem[i]);
+				has_commands = true;
+			}
 		}
+		for (uint32_t i = 0; i < SHARD_COUNT; i++) {
+			shards[i].mutex.unlock();
+		}
+
+		return has_commands;
 	}
 
-	_FORCE_INLINE_ void _prevent_sync_wraparound() {
-		bool safe_to_reset = !sync_awaiters;
-		bool already_sync_to_latest = sync_head == sync_tail;
-		if (safe_to_reset && already_sync_to_latest) {
-			sync_head = 0;
-			sync_tail = 0;
+	_FORCE_INLINE_ void _execute_command(uint32_t p_shard, uint64_t &r_read_ptr, MutexLock<BinaryMutex> &p_lock) {
+		const CommandHeader *header = reinterpret_cast<const CommandHeader *>(&flush_mem[p_shard][r_read_ptr]);
+		CommandBase *cmd = reinterpret_cast<CommandBase *>(&flush_mem[p_shard][r_read_ptr + sizeof(CommandHeader)]);
+
+		uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(p_lock);
+		cmd->call();
+		WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
+
+		if (unlikely(header->sync_done)) {
+			{
+				MutexLock sync_lock(sync_mutex);
+				*header->sync_done = true;
+			}
+			sync_cond_var.notify_all();
 		}
+
+		cmd->~CommandBase();
+
+		r_read_ptr += sizeof(CommandHeader) + header->size;
 	}
 
 	void _flush() {
-		if (unlikely(flush_read_ptr)) {
+		if (unlikely(flushing)) {
 			// Re-entrant call.
 			return;
 		}
 
-		MutexLock lock(mutex);
-
-		while (flush_read_ptr < command_mem.size()) {
-			uint64_t size = *(uint64_t *)&command_mem[flush_read_ptr];
-			flush_read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-			uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(lock);
-			cmd->call();
-			WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
-
-			// Handle potential realloc due to the command and unlock allowance.
-			cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-
-			if (unlikely(cmd->sync)) {
-				sync_head++;
-				lock.~MutexLock(); // Give an opportunity to awaiters right away.
-				sync_cond_var.notify_all();
-				new (&lock) MutexLock(mutex);
-				// Handle potential realloc happened during unlock.
-				cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
+		MutexLock lock(flush_mutex);
+		flushing = true;
+
+		// Commands pushed while flushing are picked up by the next iteration.
+		while (_take_commands()) {
+			uint32_t active[SHARD_COUNT];
+			uint64_t read_ptrs[SHARD_COUNT];
+			uint32_t active_count = 0;
+			for (uint32_t i = 0; i < SHARD_COUNT; i++) {
+				if (!flush_mem[i].is_empty()) {
+					active[active_count] = i;
+					read_ptrs[active_count] = 0;
+					active_count++;
+				}
 			}
 
-			cmd->~CommandBase();
+			if (active_count == 1) {
+				// Single producer, commands are already in order.
+				while (read_ptrs[0] < flush_mem[active[0]].size()) {
+					_execute_command(active[0], read_ptrs[0], lock);
+				}
+			} else {
+				// Merge the shards by sequence number.
+				while (true) {
+					uint32_t next = active_count;
+					uint64_t next_seq_found = UINT64_MAX;
+					for (uint32_t i = 0; i < active_count; i++) {
+						if (read_ptrs[i] < flush_mem[active[i]].size()) {
+							const CommandHeader *header = reinterpret_cast<const CommandHeader *>(&flush_mem[active[i]][read_ptrs[i]]);
+							if (header->seq < next_seq_found) {
+								next_seq_found = header->seq;
+								next = i;
+							}
+						}
+					}
+					if (next == active_count) {
+						break;
+					}
+					_execute_command(active[next], read_ptrs[next], lock);
+				}
+			}
 
-			flush_read_ptr += size;
+			for (uint32_t i = 0; i < active_count; i++) {
+				flush_mem[active[i]].clear();
+			}
 		}
 
-		command_mem.clear();
-		pending.store(false);
-		flush_read_ptr = 0;
-
-		_prevent_sync_wraparound();
+		flushing = false;
 	}
 
-	_FORCE_INLINE_ void _wait_for_sync(MutexLock<BinaryMutex> &p_lock) {
-		sync_awaiters++;
-		uint32_t sync_head_goal = sync_tail;
-		do {
-			sync_cond_var.wait(p_lock);
-		} while (sync_head < sync_head_goal);
-		sync_awaiters--;
-		_prevent_sync_wraparound();
+	_FORCE_INLINE_ void _wait_for_sync(const bool &p_sync_done) {
+		MutexLock lock(sync_mutex);
+		while (!p_sync_done) {
+			sync_cond_var.wait(lock);
+		}
 	}
 
 	void _no_op() {}
@@ -209,14 +281,14 @@ public:
 	template <typename T, typename M, typename... Args>
 	void push(T *p_instance, M p_method, Args &&...p_args) {
 		// Standard command, no sync.
-		using CommandType = Command<T, M, false, Args...>;
+		using CommandType = Command<T, M, Args...>;
 		_push_internal<CommandType, false>(p_instance, p_method, std::forward<Args>(p_args)...);
 	}
 
 	template <typename T, typename M, typename... Args>
 	void push_and_sync(T *p_instance, M p_method, Args... p_args) {
 		// Standard command, sync.
-		using CommandType = Command<T, M, true, Args...>;
+		using CommandType = Command<T, M, Args...>;
 		_push_internal<CommandType, true>(p_instance, p_method, std::forward<Args>(p_args)...);
 	}
 
@@ -242,14 +314,14 @@ public:
 	}
 
 	void wait_and_flush() {
-		ERR_FAIL_COND(pump_task_id == WorkerThreadPool::INVALID_TASK_ID);
-		WorkerThreadPool::get_singleton()->wait_for_task_completion(pump_task_id);
+		const WorkerThreadPool::TaskID pump_task = pump_task_id.load();
+		ERR_FAIL_COND(pump_task == WorkerThreadPool::INVALID_TASK_ID);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(pump_task);
 		_flush();
 	}
 
 	void set_pump_task_id(WorkerThreadPool::TaskID p_task_id) {
-		MutexLock lock(mutex);
-		pump_task_id = p_task_id;
+		pump_task_id.store(p_task_id);
 	}
 
 	CommandQueueMT();
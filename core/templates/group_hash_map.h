@@ -0,0 +1,688 @@
+/**************************************************************************/
+/*  group_hash_map.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/hash_map.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GROUP_HASH_MAP_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define GROUP_HASH_MAP_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**
+ * A group of metadata bytes of a GroupHashMap, probed in parallel.
+ *
+ * Every slot of the table has one metadata byte: the lowest 7 bits of the
+ * hash when the slot is used, or EMPTY/DELETED (high bit set) otherwise.
+ * A whole group is compared against a hash with a single SSE2 or NEON
+ * instruction, resulting in a bit mask of candidate slots.
+ */
+struct GroupHashMapGroup {
+	static constexpr uint32_t SIZE = 16;
+	static constexpr uint8_t EMPTY = 0x80;
+	static constexpr uint8_t DELETED = 0xFE;
+
+#if defined(GROUP_HASH_MAP_SSE2)
+	__m128i metadata;
+
+	_FORCE_INLINE_ explicit GroupHashMapGroup(const uint8_t *p_metadata) {
+		metadata = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_metadata));
+	}
+
+	_FORCE_INLINE_ uint32_t match(uint8_t p_h2) const {
+		return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(char(p_h2)), metadata)));
+	}
+
+	// Slots that are either empty or deleted have the high bit set.
+	_FORCE_INLINE_ uint32_t match_free() const {
+		return uint32_t(_mm_movemask_epi8(metadata));
+	}
+#elif defined(GROUP_HASH_MAP_NEON)
+	uint8x16_t metadata;
+
+	static _FORCE_INLINE_ uint32_t _to_mask(uint8x16_t p_compare) {
+		static const uint8_t bits[SIZE] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+		const uint8x16_t masked = vandq_u8(p_compare, vld1q_u8(bits));
+		return uint32_t(vaddv_u8(vget_low_u8(masked))) | (uint32_t(vaddv_u8(vget_high_u8(masked))) << 8);
+	}
+
+	_FORCE_INLINE_ explicit GroupHashMapGroup(const uint8_t *p_metadata) {
+		metadata = vld1q_u8(p_metadata);
+	}
+
+	_FORCE_INLINE_ uint32_t match(uint8_t p_h2) const {
+		return _to_mask(vceqq_u8(metadata, vdupq_n_u8(p_h2)));
+	}
+
+	_FORCE_INLINE_ uint32_t match_free() const {
+		return _to_mask(vcltzq_s8(vreinterpretq_s8_u8(metadata)));
+	}
+#else
+	uint8_t metadata[SIZE];
+
+	_FORCE_INLINE_ explicit GroupHashMapGroup(const uint8_t *p_metadata) {
+		memcpy(metadata, p_metadata, SIZE);
+	}
+
+	_FORCE_INLINE_ uint32_t match(uint8_t p_h2) const {
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < SIZE; i++) {
+			mask |= uint32_t(metadata[i] == p_h2) << i;
+		}
+		return mask;
+	}
+
+	_FORCE_INLINE_ uint32_t match_free() const {
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < SIZE; i++) {
+			mask |= uint32_t(metadata[i] >> 7) << i;
+		}
+		return mask;
+	}
+#endif
+
+	_FORCE_INLINE_ uint32_t match_empty() const {
+		return match(EMPTY);
+	}
+
+	// Index of the lowest set bit, p_mask must not be 0.
+	static _FORCE_INLINE_ uint32_t first(uint32_t p_mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index;
+		_BitScanForward(&index, p_mask);
+		return index;
+#else
+		return __builtin_ctz(p_mask);
+#endif
+	}
+};
+
+/**
+ * A HashMap implementation that uses open addressing with groups of metadata
+ * bytes (Swiss table style). Lookups compare a whole group of 16 slots at once
+ * against 7 bits of the hash, so only real candidates need a key comparison,
+ * and a miss usually stops at the first group. Groups are probed quadratically.
+ * Erased slots are marked as deleted unless their group still has an empty slot.
+ *
+ * The public API, element storage and iteration order are the same as HashMap:
+ * keys and values are stored in a double linked list by insertion order, so
+ * pointers to values remain valid until the element is erased. Use it as a
+ * drop-in replacement for lookup-heavy maps.
+ */
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>,
+		typename Allocator = DefaultTypedAllocator<HashMapElement<TKey, TValue>>>
+class GroupHashMap : private Allocator {
+public:
+	static constexpr uint32_t GROUP_SIZE = GroupHashMapGroup::SIZE;
+	// Must be a power of two and a multiple of GROUP_SIZE.
+	static constexpr uint32_t MIN_CAPACITY = GROUP_SIZE;
+
+private:
+	typedef HashMapElement<TKey, TValue> Element;
+
+	uint8_t *metadata = nullptr;
+	Element **elements = nullptr;
+	Element *head_element = nullptr;
+	Element *tail_element = nullptr;
+
+	uint32_t capacity = MIN_CAPACITY;
+	uint32_t num_elements = 0;
+	uint32_t num_deleted = 0;
+
+	_FORCE_INLINE_ static uint32_t _hash(const TKey &p_key) {
+		// The low bits go to the metadata and the high bits select the group, so make sure both are well mixed.
+		return hash_fmix32(Hasher::hash(p_key));
+	}
+
+	_FORCE_INLINE_ static uint8_t _h2(uint32_t p_hash) {
+		return p_hash & 0x7F;
+	}
+
+	_FORCE_INLINE_ static uint32_t _get_max_load(uint32_t p_capacity) {
+		return p_capacity - p_capacity / 8; // 87.5% occupancy, including deleted slots.
+	}
+
+	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		return elements != nullptr && num_elements > 0 && _lookup_pos_unchecked(p_key, _hash(p_key), r_pos);
+	}
+
+	/// Note: Assumes that elements != nullptr
+	bool _lookup_pos_unchecked(const TKey &p_key, uint32_t p_hash, uint32_t &r_pos) const {
+		const uint32_t group_mask = capacity / GROUP_SIZE - 1;
+		const uint8_t h2 = _h2(p_hash);
+		uint32_t group = (p_hash >> 7) & group_mask;
+
+		for (uint32_t step = 1; step <= group_mask + 1; step++) {
+			const uint32_t base = group * GROUP_SIZE;
+			const GroupHashMapGroup g(metadata + base);
+
+			for (uint32_t mask = g.match(h2); mask != 0; mask &= mask - 1) {
+				const uint32_t pos = base + GroupHashMapGroup::first(mask);
+				if (Comparator::compare(elements[pos]->data.key, p_key)) {
+					r_pos = pos;
+					return true;
+				}
+			}
+
+			if (g.match_empty() != 0) {
+				return false;
+			}
+
+			// Triangular numbers visit every group when the group count is a power of two.
+			group = (group + step) & group_mask;
+		}
+
+		return false;
+	}
+
+	void _insert_element(uint32_t p_hash, Element *p_value) {
+		const uint32_t group_mask = capacity / GROUP_SIZE - 1;
+		uint32_t group = (p_hash >> 7) & group_mask;
+
+		for (uint32_t step = 1;; step++) {
+			const uint32_t base = group * GROUP_SIZE;
+			const uint32_t mask = GroupHashMapGroup(metadata + base).match_free();
+			if (mask != 0) {
+				const uint32_t pos = base + GroupHashMapGroup::first(mask);
+				if (metadata[pos] == GroupHashMapGroup::DELETED) {
+					num_deleted--;
+				}
+				metadata[pos] = _h2(p_hash);
+				elements[pos] = p_value;
+				num_elements++;
+				return;
+			}
+
+			group = (group + step) & group_mask;
+		}
+	}
+
+	void _erase_pos(uint32_t p_pos) {
+		// If the group still has an empty slot, no probe sequence can have continued past it.
+		const uint32_t base = p_pos & ~(GROUP_SIZE - 1);
+		if (GroupHashMapGroup(metadata + base).match_empty() != 0) {
+			metadata[p_pos] = GroupHashMapGroup::EMPTY;
+		} else {
+			metadata[p_pos] = GroupHashMapGroup::DELETED;
+			num_deleted++;
+		}
+		elements[p_pos] = nullptr;
+		num_elements--;
+	}
+
+	void _allocate(uint32_t p_capacity) {
+		capacity = p_capacity;
+		num_elements = 0;
+		num_deleted = 0;
+		metadata = reinterpret_cast<uint8_t *>(Memory::alloc_static(sizeof(uint8_t) * capacity));
+		memset(metadata, GroupHashMapGroup::EMPTY, sizeof(uint8_t) * capacity);
+		elements = reinterpret_cast<Element **>(Memory::alloc_static_zeroed(sizeof(Element *) * capacity));
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		uint8_t *old_metadata = metadata;
+		Element **old_elements = elements;
+
+		_allocate(p_new_capacity);
+
+		// The linked list holds every element, no need to walk the old table.
+		for (Element *E = head_element; E; E = E->next) {
+			_insert_element(_hash(E->data.key), E);
+		}
+
+		if (old_elements != nullptr) {
+			Memory::free_static(old_elements);
+			Memory::free_static(old_metadata);
+		}
+	}
+
+	static uint32_t _get_capacity_for(uint32_t p_size) {
+		uint32_t new_capacity = MIN_CAPACITY;
+		while (_get_max_load(new_capacity) < p_size) {
+			new_capacity <<= 1;
+		}
+		return new_capacity;
+	}
+
+	_FORCE_INLINE_ Element *_insert(const TKey &p_key, const TValue &p_value, uint32_t p_hash, bool p_front_insert = false) {
+		if (unlikely(elements == nullptr)) {
+			// Allocate on demand to save memory.
+			_allocate(capacity);
+		}
+
+		if (unlikely(num_elements + num_deleted + 1 > _get_max_load(capacity))) {
+			// Only grow if the table is really full, otherwise just get rid of the deleted slots.
+			if (num_elements + 1 > _get_max_load(capacity) / 2) {
+				ERR_FAIL_COND_V_MSG(capacity >= (1u << 31), nullptr, "Hash table maximum capacity reached, aborting insertion.");
+				_resize_and_rehash(capacity * 2);
+			} else {
+				_resize_and_rehash(capacity);
+			}
+		}
+
+		Element *elem = Allocator::new_allocation(Element(p_key, p_value));
+
+		if (tail_element == nullptr) {
+			head_element = elem;
+			tail_element = elem;
+		} else if (p_front_insert) {
+			head_element->prev = elem;
+			elem->next = head_element;
+			head_element = elem;
+		} else {
+			tail_element->next = elem;
+			elem->prev = tail_element;
+			tail_element = elem;
+		}
+
+		_insert_element(p_hash, elem);
+		return elem;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (elements == nullptr || (num_elements == 0 && num_deleted == 0)) {
+			return;
+		}
+
+		Element *E = head_element;
+		while (E) {
+			Element *next = E->next;
+			Allocator::delete_allocation(E);
+			E = next;
+		}
+
+		memset(metadata, GroupHashMapGroup::EMPTY, sizeof(uint8_t) * capacity);
+		memset(elements, 0, sizeof(Element *) * capacity);
+
+		tail_element = nullptr;
+		head_element = nullptr;
+		num_elements = 0;
+		num_deleted = 0;
+	}
+
+	void sort() {
+		sort_custom<KeyValueSort<TKey, TValue>>();
+	}
+
+	template <typename C>
+	void sort_custom() {
+		if (size() < 2) {
+			return;
+		}
+
+		SortList<Element, KeyValue<TKey, TValue>, &Element::data, &Element::prev, &Element::next, C> sorter;
+		sorter.sort(head_element, tail_element);
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "GroupHashMap key not found.");
+		return elements[pos]->data.value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "GroupHashMap key not found.");
+		return elements[pos]->data.value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			return &elements[pos]->data.value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			return &elements[pos]->data.value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		return _lookup_pos(p_key, _pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (!exists) {
+			return false;
+		}
+
+		Element *element = elements[pos];
+		_erase_pos(pos);
+
+		if (head_element == element) {
+			head_element = element->next;
+		}
+
+		if (tail_element == element) {
+			tail_element = element->prev;
+		}
+
+		if (element->prev) {
+			element->prev->next = element->next;
+		}
+
+		if (element->next) {
+			element->next->prev = element->prev;
+		}
+
+		Allocator::delete_allocation(element);
+		return true;
+	}
+
+	// Replace the key of an entry in-place, without invalidating iterators or changing the entries position during iteration.
+	// p_old_key must exist in the map and p_new_key must not, unless it is equal to p_old_key.
+	bool replace_key(const TKey &p_old_key, const TKey &p_new_key) {
+		ERR_FAIL_COND_V(elements == nullptr || num_elements == 0, false);
+		if (p_old_key == p_new_key) {
+			return true;
+		}
+		const uint32_t new_hash = _hash(p_new_key);
+		uint32_t pos = 0;
+		ERR_FAIL_COND_V(_lookup_pos_unchecked(p_new_key, new_hash, pos), false);
+		ERR_FAIL_COND_V(!_lookup_pos(p_old_key, pos), false);
+		Element *element = elements[pos];
+
+		// _insert_element will increment the element count again.
+		_erase_pos(pos);
+
+		// Update the HashMapElement with the new key and reinsert it.
+		const_cast<TKey &>(element->data.key) = p_new_key;
+		_insert_element(new_hash, element);
+
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		ERR_FAIL_COND_MSG(p_new_capacity < size(), "reserve() called with a capacity smaller than the current size. This is likely a mistake.");
+		const uint32_t new_capacity = _get_capacity_for(p_new_capacity);
+
+		if (new_capacity <= capacity) {
+			return;
+		}
+
+		if (elements == nullptr) {
+			capacity = new_capacity;
+			return; // Unallocated yet.
+		}
+		_resize_and_rehash(new_capacity);
+	}
+
+	/** Iterator API **/
+
+	typedef typename HashMap<TKey, TValue, Hasher, Comparator, Allocator>::ConstIterator ConstIterator;
+	typedef typename HashMap<TKey, TValue, Hasher, Comparator, Allocator>::Iterator Iterator;
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(head_element);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(nullptr);
+	}
+	_FORCE_INLINE_ Iterator last() {
+		return Iterator(tail_element);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		if (!exists) {
+			return end();
+		}
+		return Iterator(elements[pos]);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(head_element);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(nullptr);
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		return ConstIterator(tail_element);
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		if (!exists) {
+			return end();
+		}
+		return ConstIterator(elements[pos]);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND(!exists);
+		return elements[pos]->data.value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		const uint32_t hash = _hash(p_key);
+		uint32_t pos = 0;
+		bool exists = elements && num_elements > 0 && _lookup_pos_unchecked(p_key, hash, pos);
+		if (!exists) {
+			return _insert(p_key, TValue(), hash)->data.value;
+		} else {
+			return elements[pos]->data.value;
+		}
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value, bool p_front_insert = false) {
+		const uint32_t hash = _hash(p_key);
+		uint32_t pos = 0;
+		bool exists = elements && num_elements > 0 && _lookup_pos_unchecked(p_key, hash, pos);
+		if (!exists) {
+			return Iterator(_insert(p_key, p_value, hash, p_front_insert));
+		} else {
+			elements[pos]->data.value = p_value;
+			return Iterator(elements[pos]);
+		}
+	}
+
+	/* Constructors */
+
+	GroupHashMap(const GroupHashMap &p_other) {
+		reserve(p_other.num_elements);
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const GroupHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		if (num_elements != 0) {
+			clear();
+		}
+
+		reserve(p_other.num_elements);
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	GroupHashMap(uint32_t p_initial_capacity) {
+		capacity = _get_capacity_for(p_initial_capacity);
+	}
+	GroupHashMap() {}
+
+	GroupHashMap(std::initializer_list<KeyValue<TKey, TValue>> p_init) {
+		reserve(p_init.size());
+		for (const KeyValue<TKey, TValue> &E : p_init) {
+			insert(E.key, E.value);
+		}
+	}
+
+	~GroupHashMap() {
+		clear();
+
+		if (elements != nullptr) {
+			Memory::free_static(elements);
+			Memory::free_static(metadata);
+		}
+	}
+};
+
+/**
+ * A HashSet built on GroupHashMap, with the same API as HashSet. Unlike HashSet,
+ * keys are stored in a linked list, so pointers to keys stay valid on insertion
+ * and iteration follows insertion order even after erasing.
+ */
+
+template <typename TKey,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class GroupHashSet {
+	struct Empty {};
+	typedef GroupHashMap<TKey, Empty, Hasher, Comparator> Map;
+	Map map;
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return map.get_capacity(); }
+	_FORCE_INLINE_ uint32_t size() const { return map.size(); }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const { return map.is_empty(); }
+	void clear() { map.clear(); }
+	_FORCE_INLINE_ bool has(const TKey &p_key) const { return map.has(p_key); }
+	bool erase(const TKey &p_key) { return map.erase(p_key); }
+	bool replace_key(const TKey &p_old_key, const TKey &p_new_key) { return map.replace_key(p_old_key, p_new_key); }
+	void reserve(uint32_t p_new_capacity) { map.reserve(p_new_capacity); }
+
+	/** Iterator API **/
+
+	struct Iterator {
+		_FORCE_INLINE_ const TKey &operator*() const { return it->key; }
+		_FORCE_INLINE_ const TKey *operator->() const { return &it->key; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			++it;
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			--it;
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return it == b.it; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return it != b.it; }
+
+		_FORCE_INLINE_ explicit operator bool() const { return bool(it); }
+
+		_FORCE_INLINE_ Iterator(const typename Map::ConstIterator &p_it) :
+				it(p_it) {}
+		_FORCE_INLINE_ Iterator() {}
+
+	private:
+		typename Map::ConstIterator it;
+	};
+
+	_FORCE_INLINE_ Iterator begin() const { return Iterator(map.begin()); }
+	_FORCE_INLINE_ Iterator end() const { return Iterator(map.end()); }
+	_FORCE_INLINE_ Iterator last() const { return Iterator(map.last()); }
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) const { return Iterator(map.find(p_key)); }
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(*p_iter);
+		}
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key) {
+		return Iterator(map.insert(p_key, Empty()));
+	}
+
+	/* Constructors */
+
+	GroupHashSet(uint32_t p_initial_capacity) :
+			map(p_initial_capacity) {}
+	GroupHashSet() {}
+
+	GroupHashSet(std::initializer_list<TKey> p_init) {
+		reserve(p_init.size());
+		for (const TKey &E : p_init) {
+			insert(E);
+		}
+	}
+};
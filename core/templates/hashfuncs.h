@@ -125,6 +125,32 @@ static _FORCE_INLINE_ uint64_t hash64_murmur3_64(uint64_t key, uint64_t seed) {
 	return key;
 }
 
+// Unlike the other float hashes, these don't normalize -0.0 and NaN. Two results only match if the
+// values were bit-identical, e.g. when checking that a simulation is reproducible.
+static _FORCE_INLINE_ uint64_t hash64_murmur3_bits(float p_in, uint64_t p_seed) {
+	union {
+		float f;
+		uint32_t i;
+	} u;
+	u.f = p_in;
+	return hash64_murmur3_64(u.i, p_seed);
+}
+
+static _FORCE_INLINE_ uint64_t hash64_murmur3_bits(double p_in, uint64_t p_seed) {
+	union {
+		double d;
+		uint64_t i;
+	} u;
+	u.d = p_in;
+	return hash64_murmur3_64(u.i, p_seed);
+}
+
+static _FORCE_INLINE_ uint64_t hash64_murmur3_bits(const Vector3 &p_in, uint64_t p_seed) {
+	p_seed = hash64_murmur3_bits(p_in.x, p_seed);
+	p_seed = hash64_murmur3_bits(p_in.y, p_seed);
+	return hash64_murmur3_bits(p_in.z, p_seed);
+}
+
 #define HASH_MURMUR3_SEED 0x7F07C65
 // Murmurhash3 32-bit version.
 // All MurmurHash versions are public domain software, and the author disclaims all copyright to their code.
@@ -32,6 +32,7 @@
 
 #include "core/os/memory.h"
 #include "core/os/mutex.h"
+#include "core/os/thread.h"
 #include "core/string/print_string.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
@@ -107,6 +108,18 @@ class RID_Alloc : public RID_AllocBase {
 	Chunk **chunks = nullptr;
 	uint32_t **free_list_chunks = nullptr;
 
+	// When thread safe, free indices live in shards picked by the calling thread instead of
+	// free_list_chunks, so threads allocating and freeing at the same time rarely contend.
+	// Chunks are published with release semantics, so lookups never need to lock.
+	static const uint32_t SHARD_BITS = 4;
+	static const uint32_t SHARD_COUNT = 1 << SHARD_BITS;
+
+	struct alignas(64) FreeListShard {
+		BinaryMutex mutex;
+		LocalVector<uint32_t> free_list;
+	};
+	FreeListShard *shards = nullptr;
+
 	uint32_t elements_in_chunk;
 	uint32_t max_alloc = 0;
 	uint32_t alloc_count = 0;
@@ -114,52 +127,144 @@ class RID_Alloc : public RID_AllocBase {
 
 	const char *description = nullptr;
 
-	mutable Mutex mutex;
+	mutable Mutex mutex; // When thread safe, only taken to grow the chunks.
 
-	_FORCE_INLINE_ RID _allocate_rid() {
+	_FORCE_INLINE_ uint32_t _get_max_alloc() const {
+		if constexpr (THREAD_SAFE) { // Pairs with the store in _grow_chunks().
+			return ((std::atomic<uint32_t> *)&max_alloc)->load(std::memory_order_acquire);
+		} else {
+			return max_alloc;
+		}
+	}
+
+	_FORCE_INLINE_ Chunk *_get_chunk(uint32_t p_chunk) const {
 		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-
-		if (alloc_count == max_alloc) {
-			//allocate a new chunk
-			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
-			if (THREAD_SAFE && chunk_count == chunk_limit) {
-				mutex.unlock();
-				if (description != nullptr) {
-					ERR_FAIL_V_MSG(RID(), vformat("Element limit for RID of type '%s' reached.", String(description)));
-				} else {
-					ERR_FAIL_V_MSG(RID(), "Element limit reached.");
-				}
-			}
+			return ((std::atomic<Chunk *> *)&chunks[p_chunk])->load(std::memory_order_acquire);
+		} else {
+			return chunks[p_chunk];
+		}
+	}
 
-			//grow chunks
-			if constexpr (!THREAD_SAFE) {
-				chunks = (Chunk **)memrealloc(chunks, sizeof(Chunk *) * (chunk_count + 1));
-			}
-			chunks[chunk_count] = (Chunk *)memalloc(sizeof(Chunk) * elements_in_chunk); //but don't initialize
+	_FORCE_INLINE_ static uint32_t _get_validator(const Chunk &p_chunk) {
+		if constexpr (THREAD_SAFE) {
+			return ((std::atomic<uint32_t> *)&p_chunk.validator)->load(std::memory_order_acquire);
+		} else {
+			return p_chunk.validator;
+		}
+	}
+
+	_FORCE_INLINE_ static void _set_validator(Chunk &p_chunk, uint32_t p_validator) {
+		if constexpr (THREAD_SAFE) {
+			((std::atomic<uint32_t> *)&p_chunk.validator)->store(p_validator, std::memory_order_release);
+		} else {
+			p_chunk.validator = p_validator;
+		}
+	}
+
+	// Adds a chunk of free elements and returns the index of its first element, or UINT32_MAX
+	// if the element limit was reached. Must be called with the mutex held when thread safe.
+	uint32_t _grow_chunks() {
+		uint32_t chunk_count = max_alloc / elements_in_chunk;
+		if (THREAD_SAFE && chunk_count == chunk_limit) {
+			return UINT32_MAX;
+		}
+
+		//grow chunks
+		if constexpr (!THREAD_SAFE) {
+			chunks = (Chunk **)memrealloc(chunks, sizeof(Chunk *) * (chunk_count + 1));
+		}
+		Chunk *chunk = (Chunk *)memalloc(sizeof(Chunk) * elements_in_chunk); //but don't initialize
+		for (uint32_t i = 0; i < elements_in_chunk; i++) {
+			chunk[i].validator = 0xFFFFFFFF;
+		}
+
+		if constexpr (THREAD_SAFE) {
+			// Publish the initialized chunk before making its indices valid.
+			((std::atomic<Chunk *> *)&chunks[chunk_count])->store(chunk, std::memory_order_release);
+			((std::atomic<uint32_t> *)&max_alloc)->store(max_alloc + elements_in_chunk, std::memory_order_release);
+		} else {
+			chunks[chunk_count] = chunk;
 			//grow free lists
-			if constexpr (!THREAD_SAFE) {
-				free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			}
+			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
 			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
-
-			//initialize
 			for (uint32_t i = 0; i < elements_in_chunk; i++) {
-				// Don't initialize chunk.
-				chunks[chunk_count][i].validator = 0xFFFFFFFF;
-				free_list_chunks[chunk_count][i] = alloc_count + i;
+				free_list_chunks[chunk_count][i] = max_alloc + i;
 			}
+			max_alloc += elements_in_chunk;
+		}
+
+		return chunk_count * elements_in_chunk;
+	}
 
-			if constexpr (THREAD_SAFE) {
-				// Store atomically to avoid data race with the load in get_or_null().
-				((std::atomic<uint32_t> *)&max_alloc)->store(max_alloc + elements_in_chunk, std::memory_order_relaxed);
-			} else {
-				max_alloc += elements_in_chunk;
+	// Refills an empty shard, first by taking half of the free indices of another shard,
+	// then by growing the chunks. Returns false if the element limit was reached.
+	bool _refill_shard(FreeListShard &p_shard) {
+		LocalVector<uint32_t> taken;
+
+		for (uint32_t i = 0; i < SHARD_COUNT && taken.is_empty(); i++) {
+			FreeListShard &other = shards[i];
+			if (&other == &p_shard) {
+				continue;
+			}
+			MutexLock lock(other.mutex);
+			uint32_t size = other.free_list.size();
+			uint32_t take = (size + 1) / 2;
+			for (uint32_t j = size - take; j < size; j++) {
+				taken.push_back(other.free_list[j]);
 			}
+			other.free_list.resize(size - take);
+		}
+
+		if (taken.is_empty()) {
+			MutexLock lock(mutex);
+			uint32_t first = _grow_chunks();
+			if (first == UINT32_MAX) {
+				return false;
+			}
+			// Reversed, so lower indices are handed out first.
+			for (uint32_t i = elements_in_chunk; i > 0; i--) {
+				taken.push_back(first + i - 1);
+			}
+		}
+
+		MutexLock lock(p_shard.mutex);
+		for (uint32_t index : taken) {
+			p_shard.free_list.push_back(index);
 		}
+		return true;
+	}
+
+	_FORCE_INLINE_ RID _allocate_rid() {
+		uint32_t free_index;
 
-		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
+		if constexpr (THREAD_SAFE) {
+			FreeListShard &shard = shards[Thread::get_caller_id() & (SHARD_COUNT - 1)];
+			shard.mutex.lock();
+			while (unlikely(shard.free_list.is_empty())) {
+				shard.mutex.unlock();
+				if (!_refill_shard(shard)) {
+					if (description != nullptr) {
+						ERR_FAIL_V_MSG(RID(), vformat("Element limit for RID of type '%s' reached.", String(description)));
+					} else {
+						ERR_FAIL_V_MSG(RID(), "Element limit reached.");
+					}
+				}
+				shard.mutex.lock();
+			}
+			free_index = shard.free_list[shard.free_list.size() - 1];
+			shard.free_list.resize(shard.free_list.size() - 1);
+			shard.mutex.unlock();
+
+			((std::atomic<uint32_t> *)&alloc_count)->fetch_add(1, std::memory_order_relaxed);
+		} else {
+			if (alloc_count == max_alloc) {
+				//allocate a new chunk
+				_grow_chunks();
+			}
+
+			free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
+			alloc_count++;
+		}
 
 		uint32_t free_chunk = free_index / elements_in_chunk;
 		uint32_t free_element = free_index % elements_in_chunk;
@@ -169,14 +274,7 @@ class RID_Alloc : public RID_AllocBase {
 		id <<= 32;
 		id |= free_index;
 
-		chunks[free_chunk][free_element].validator = validator;
-		chunks[free_chunk][free_element].validator |= 0x80000000; //mark uninitialized bit
-
-		alloc_count++;
-
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
-		}
+		_set_validator(_get_chunk(free_chunk)[free_element], validator | 0x80000000); //mark uninitialized bit
 
 		return _make_from_id(id);
 	}
@@ -203,19 +301,9 @@ public:
 			return nullptr;
 		}
 
-		if constexpr (THREAD_SAFE) {
-			SYNC_ACQUIRE;
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		uint32_t ma;
-		if constexpr (THREAD_SAFE) { // Read atomically to avoid data race with the store in _allocate_rid().
-			ma = ((std::atomic<uint32_t> *)&max_alloc)->load(std::memory_order_relaxed);
-		} else {
-			ma = max_alloc;
-		}
-		if (unlikely(idx >= ma)) {
+		if (unlikely(idx >= _get_max_alloc())) {
 			return nullptr;
 		}
 
@@ -224,47 +312,27 @@ public:
 
 		uint32_t validator = uint32_t(id >> 32);
 
-		if constexpr (THREAD_SAFE) {
-#ifdef TSAN_ENABLED
-			__tsan_acquire(&chunks[idx_chunk]); // We know not a race in practice.
-			__tsan_acquire(&chunks[idx_chunk][idx_element]); // We know not a race in practice.
-#endif
-		}
-
-		Chunk &c = chunks[idx_chunk][idx_element];
-
-		if constexpr (THREAD_SAFE) {
-#ifdef TSAN_ENABLED
-			__tsan_release(&chunks[idx_chunk]);
-			__tsan_release(&chunks[idx_chunk][idx_element]);
-			__tsan_acquire(&c.validator); // We know not a race in practice.
-#endif
-		}
+		Chunk &c = _get_chunk(idx_chunk)[idx_element];
+		uint32_t current = _get_validator(c);
 
 		if (unlikely(p_initialize)) {
-			if (unlikely(!(c.validator & 0x80000000))) {
+			if (unlikely(!(current & 0x80000000))) {
 				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
 			}
 
-			if (unlikely((c.validator & 0x7FFFFFFF) != validator)) {
+			if (unlikely((current & 0x7FFFFFFF) != validator)) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
 			}
 
-			c.validator &= 0x7FFFFFFF; //initialized
+			_set_validator(c, current & 0x7FFFFFFF); //initialized
 
-		} else if (unlikely(c.validator != validator)) {
-			if ((c.validator & 0x80000000) && c.validator != 0xFFFFFFFF) {
+		} else if (unlikely(current != validator)) {
+			if ((current & 0x80000000) && current != 0xFFFFFFFF) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
 		}
 
-		if constexpr (THREAD_SAFE) {
-#ifdef TSAN_ENABLED
-			__tsan_release(&c.validator);
-#endif
-		}
-
 		T *ptr = &c.data;
 
 		return ptr;
@@ -310,16 +378,9 @@ public:
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
+		if (unlikely(idx >= _get_max_alloc())) {
 			return false;
 		}
 
@@ -328,26 +389,13 @@ public:
 
 		uint32_t validator = uint32_t(id >> 32);
 
-		bool owned = (chunks[idx_chunk][idx_element].validator & 0x7FFFFFFF) == validator;
-
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
-		}
-
-		return owned;
+		return (_get_validator(_get_chunk(idx_chunk)[idx_element]) & 0x7FFFFFFF) == validator;
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
+		if (unlikely(idx >= _get_max_alloc())) {
 			ERR_FAIL();
 		}
 
@@ -355,66 +403,68 @@ public:
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(chunks[idx_chunk][idx_element].validator & 0x80000000)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
+
+		Chunk &c = _get_chunk(idx_chunk)[idx_element];
+		uint32_t current = _get_validator(c);
+		if (unlikely(current & 0x80000000)) {
 			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
-		} else if (unlikely(chunks[idx_chunk][idx_element].validator != validator)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
+		} else if (unlikely(current != validator)) {
 			ERR_FAIL();
 		}
 
-		chunks[idx_chunk][idx_element].data.~T();
-		chunks[idx_chunk][idx_element].validator = 0xFFFFFFFF; // go invalid
+		if constexpr (THREAD_SAFE) {
+			// Claim the element first, so only one of several threads freeing the same RID gets to destroy it.
+			if (unlikely(!((std::atomic<uint32_t> *)&c.validator)->compare_exchange_strong(current, 0xFFFFFFFF, std::memory_order_acq_rel))) {
+				ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
+			}
 
-		alloc_count--;
-		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
+			c.data.~T();
 
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
+			FreeListShard &shard = shards[Thread::get_caller_id() & (SHARD_COUNT - 1)];
+			shard.mutex.lock();
+			shard.free_list.push_back(idx);
+			shard.mutex.unlock();
+
+			((std::atomic<uint32_t> *)&alloc_count)->fetch_sub(1, std::memory_order_relaxed);
+		} else {
+			c.data.~T();
+			c.validator = 0xFFFFFFFF; // go invalid
+
+			alloc_count--;
+			free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
 		}
 	}
 
 	_FORCE_INLINE_ uint32_t get_rid_count() const {
-		return alloc_count;
+		if constexpr (THREAD_SAFE) {
+			return ((std::atomic<uint32_t> *)&alloc_count)->load(std::memory_order_relaxed);
+		} else {
+			return alloc_count;
+		}
 	}
 	LocalVector<RID> get_owned_list() const {
 		LocalVector<RID> owned;
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
+		uint32_t ma = _get_max_alloc();
+		for (size_t i = 0; i < ma; i++) {
+			uint64_t validator = _get_validator(_get_chunk(i / elements_in_chunk)[i % elements_in_chunk]);
 			if (validator != 0xFFFFFFFF) {
 				owned.push_back(_make_from_id((validator << 32) | i));
 			}
 		}
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
-		}
 		return owned;
 	}
 
 	//used for fast iteration in the elements or RIDs
 	void fill_owned_buffer(RID *p_rid_buffer) const {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
 		uint32_t idx = 0;
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
+		uint32_t ma = _get_max_alloc();
+		for (size_t i = 0; i < ma; i++) {
+			uint64_t validator = _get_validator(_get_chunk(i / elements_in_chunk)[i % elements_in_chunk]);
 			if (validator != 0xFFFFFFFF) {
 				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
 			}
 		}
-
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
-		}
 	}
 
 	void set_description(const char *p_description) {
@@ -426,7 +476,7 @@ public:
 		if constexpr (THREAD_SAFE) {
 			chunk_limit = (p_maximum_number_of_elements / elements_in_chunk) + 1;
 			chunks = (Chunk **)memalloc(sizeof(Chunk *) * chunk_limit);
-			free_list_chunks = (uint32_t **)memalloc(sizeof(uint32_t *) * chunk_limit);
+			shards = memnew_arr(FreeListShard, SHARD_COUNT);
 			SYNC_RELEASE;
 		}
 	}
@@ -454,13 +504,20 @@ public:
 		uint32_t chunk_count = max_alloc / elements_in_chunk;
 		for (uint32_t i = 0; i < chunk_count; i++) {
 			memfree(chunks[i]);
-			memfree(free_list_chunks[i]);
+			if constexpr (!THREAD_SAFE) {
+				memfree(free_list_chunks[i]);
+			}
 		}
 
 		if (chunks) {
 			memfree(chunks);
+		}
+		if (free_list_chunks) {
 			memfree(free_list_chunks);
 		}
+		if (shards) {
+			memdelete_arr(shards);
+		}
 	}
 };
 
@@ -133,6 +133,10 @@ public:
 		}
 	}
 
+	_ALWAYS_INLINE_ bool compare_exchange_weak(T &r_expected, T p_desired) {
+		return value.compare_exchange_weak(r_expected, p_desired, std::memory_order_acq_rel, std::memory_order_acquire);
+	}
+
 	_ALWAYS_INLINE_ T conditional_increment() {
 		while (true) {
 			T c = value.load(std::memory_order_acquire);
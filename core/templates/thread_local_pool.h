@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*  thread_local_pool.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/memory.h"
+
+#include <type_traits>
+
+// Per-thread free list cache for small objects of a single type.
+// Freed blocks are kept in a list owned by the thread that frees them, and
+// are handed back to the next allocation on that thread without touching the
+// global heap or taking any lock. Once a thread caches MAX_CACHED blocks,
+// further frees go straight back to the heap, and the whole cache is released
+// when the thread exits.
+//
+// Objects may be freed from a different thread than the one that allocated
+// them, so it is safe to use for reference counted containers shared between
+// threads.
+template <typename T, uint32_t MAX_CACHED = 256>
+class ThreadLocalPool {
+	static constexpr size_t BLOCK_SIZE = sizeof(T) > sizeof(void *) ? sizeof(T) : sizeof(void *);
+
+	struct FreeList {
+		void *head = nullptr;
+		uint32_t count = 0;
+
+		~FreeList() {
+			while (head) {
+				void *next = *(void **)head;
+				Memory::free_static(head, false);
+				head = next;
+			}
+			// Objects freed by thread local destructors that run after this one go back to the heap.
+			count = MAX_CACHED;
+		}
+	};
+
+	static inline thread_local FreeList free_list;
+
+public:
+	template <typename... Args>
+	_FORCE_INLINE_ static T *alloc(Args &&...p_args) {
+		FreeList &list = free_list;
+		void *mem = list.head;
+		if (likely(mem)) {
+			list.head = *(void **)mem;
+			list.count--;
+			Memory::_record_pool_hit();
+		} else {
+			mem = Memory::alloc_static(BLOCK_SIZE, false);
+			ERR_FAIL_NULL_V(mem, nullptr);
+			Memory::_record_pool_miss();
+		}
+		return memnew_placement(mem, T(std::forward<Args>(p_args)...));
+	}
+
+	_FORCE_INLINE_ static void free(T *p_mem) {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			p_mem->~T();
+		}
+		FreeList &list = free_list;
+		if (likely(list.count < MAX_CACHED)) {
+			*(void **)p_mem = list.head;
+			list.head = p_mem;
+			list.count++;
+		} else {
+			Memory::free_static(p_mem, false);
+		}
+	}
+
+	// Number of blocks cached by the calling thread.
+	static uint32_t get_cached_count() {
+		return free_list.head ? free_list.count : 0;
+	}
+};
+
+// Typed allocator backed by a ThreadLocalPool, for use with HashMap and other
+// node based containers.
+template <typename T>
+class ThreadLocalPoolAllocator {
+public:
+	template <typename... Args>
+	_FORCE_INLINE_ T *new_allocation(Args &&...p_args) { return ThreadLocalPool<T>::alloc(std::forward<Args>(p_args)...); }
+	_FORCE_INLINE_ void delete_allocation(T *p_allocation) { ThreadLocalPool<T>::free(p_allocation); }
+};
@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*  work_stealing_deque.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+
+#include <atomic>
+#include <type_traits>
+
+// A Chase-Lev work-stealing deque, with the memory orderings from
+// "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al., 2013).
+// Only the owner thread may push() and pop(), which work at the bottom end. Any thread
+// may steal() from the top end. None of them block, and only a steal racing for the
+// same item, or a pop racing a steal for the last one, needs a compare-and-swap.
+// The buffer grows as needed. Replaced buffers are kept until the deque is destroyed,
+// since thieves may still be reading from them.
+template <typename T>
+class WorkStealingDeque {
+	static_assert(std::is_trivially_copyable_v<T>);
+	static_assert(std::atomic<T>::is_always_lock_free);
+
+	struct Buffer {
+		int64_t mask = 0;
+		std::atomic<T> *items = nullptr;
+
+		_FORCE_INLINE_ T get(int64_t p_index) const { return items[p_index & mask].load(std::memory_order_relaxed); }
+		_FORCE_INLINE_ void set(int64_t p_index, T p_value) { items[p_index & mask].store(p_value, std::memory_order_relaxed); }
+	};
+
+	// Written by thieves and the owner, so kept apart from bottom, which only the owner writes.
+	// Padded rather than aligned, since the owner may live in storage that isn't over-aligned.
+	std::atomic<int64_t> top = 0;
+	char _top_padding[64 - sizeof(std::atomic<int64_t>)];
+	std::atomic<int64_t> bottom = 0;
+	std::atomic<Buffer *> buffer = nullptr;
+	LocalVector<Buffer *> retired_buffers;
+
+	static Buffer *_alloc_buffer(int64_t p_capacity) {
+		Buffer *new_buffer = memnew(Buffer);
+		new_buffer->mask = p_capacity - 1;
+		new_buffer->items = memnew_arr(std::atomic<T>, p_capacity);
+		return new_buffer;
+	}
+
+	static void _free_buffer(Buffer *p_buffer) {
+		memdelete_arr(p_buffer->items);
+		memdelete(p_buffer);
+	}
+
+	Buffer *_grow(Buffer *p_buffer, int64_t p_top, int64_t p_bottom) {
+		Buffer *new_buffer = _alloc_buffer((p_buffer->mask + 1) * 2);
+		for (int64_t i = p_top; i < p_bottom; i++) {
+			new_buffer->set(i, p_buffer->get(i));
+		}
+		retired_buffers.push_back(p_buffer);
+		buffer.store(new_buffer, std::memory_order_release);
+		return new_buffer;
+	}
+
+public:
+	// Owner only.
+	void push(T p_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed);
+		int64_t t = top.load(std::memory_order_acquire);
+		Buffer *current = buffer.load(std::memory_order_relaxed);
+		if (b - t > current->mask) {
+			current = _grow(current, t, b);
+		}
+		current->set(b, p_value);
+		// Publishes the item, and everything written before pushing it, to the thieves.
+		bottom.store(b + 1, std::memory_order_release);
+	}
+
+	// Owner only. Takes the most recently pushed item.
+	bool pop(T &r_value) {
+		int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+		Buffer *current = buffer.load(std::memory_order_relaxed);
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t t = top.load(std::memory_order_relaxed);
+
+		if (t > b) {
+			// Empty.
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		r_value = current->get(b);
+		if (t == b) {
+			// Last item, race the thieves for it.
+			bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return won;
+		}
+		return true;
+	}
+
+	// Any thread. Takes the oldest item. Also fails when losing a race for it,
+	// which callers can treat like an empty deque and move on to the next one.
+	bool steal(T &r_value) {
+		int64_t t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t b = bottom.load(std::memory_order_acquire);
+		if (t >= b) {
+			return false;
+		}
+
+		T value = buffer.load(std::memory_order_acquire)->get(t);
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			return false;
+		}
+		r_value = value;
+		return true;
+	}
+
+	// Any thread. Only a snapshot, which may be outdated as soon as it's returned.
+	_FORCE_INLINE_ bool is_empty() const {
+		return bottom.load(std::memory_order_acquire) <= top.load(std::memory_order_acquire);
+	}
+
+	WorkStealingDeque(int64_t p_initial_capacity = 64) {
+		DEV_ASSERT(p_initial_capacity > 0 && (p_initial_capacity & (p_initial_capacity - 1)) == 0);
+		buffer.store(_alloc_buffer(p_initial_capacity), std::memory_order_relaxed);
+	}
+
+	~WorkStealingDeque() {
+		_free_buffer(buffer.load(std::memory_order_relaxed));
+		for (Buffer *retired_buffer : retired_buffers) {
+			_free_buffer(retired_buffer);
+		}
+	}
+};
@@ -34,6 +34,7 @@
 #include "core/math/math_funcs.h"
 #include "core/object/script_language.h"
 #include "core/templates/hashfuncs.h"
+#include "core/templates/thread_local_pool.h"
 #include "core/templates/vector.h"
 #include "core/variant/callable.h"
 #include "core/variant/dictionary.h"
@@ -76,7 +77,7 @@ void Array::_unref() const {
 		if (_p->read_only) {
 			memdelete(_p->read_only);
 		}
-		memdelete(_p);
+		ThreadLocalPool<ArrayPrivate>::free(_p);
 	}
 	_p = nullptr;
 }
@@ -862,7 +863,7 @@ const void *Array::id() const {
 }
 
 Array::Array(const Array &p_from, uint32_t p_type, const StringName &p_class_name, const Variant &p_script) {
-	_p = memnew(ArrayPrivate);
+	_p = ThreadLocalPool<ArrayPrivate>::alloc();
 	_p->refcount.init();
 	set_typed(p_type, p_class_name, p_script);
 	assign(p_from);
@@ -941,13 +942,13 @@ Array::Array(const Array &p_from) {
 }
 
 Array::Array(std::initializer_list<Variant> p_init) {
-	_p = memnew(ArrayPrivate);
+	_p = ThreadLocalPool<ArrayPrivate>::alloc();
 	_p->refcount.init();
 	_p->array = Vector<Variant>(p_init);
 }
 
 Array::Array() {
-	_p = memnew(ArrayPrivate);
+	_p = ThreadLocalPool<ArrayPrivate>::alloc();
 	_p->refcount.init();
 }
 
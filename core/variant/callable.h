@@ -82,6 +82,8 @@ public:
 		}
 		return call_deferredp(sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
 	}
+	// Like call_deferred(), but does nothing if this callable is already queued for the current flush.
+	void call_deferred_coalesced() const;
 
 	Error rpcp(int p_id, const Variant **p_arguments, int p_argcount, CallError &r_call_error) const;
 
@@ -34,6 +34,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
+#include "core/templates/thread_local_pool.h"
 #include "core/variant/array.h"
 #include "core/variant/variant_deep_duplicate.h"
 
@@ -52,7 +53,9 @@ class Dictionary {
 	void _unref() const;
 
 public:
-	using ConstIterator = HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator;
+	// Elements come from a thread local pool, as dictionaries are frequently built and discarded.
+	using VariantMap = HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator, ThreadLocalPoolAllocator<HashMapElement<Variant, Variant>>>;
+	using ConstIterator = VariantMap::ConstIterator;
 
 	ConstIterator begin() const;
 	ConstIterator end() const;
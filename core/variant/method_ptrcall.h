@@ -43,8 +43,10 @@ struct PtrToArgDirect {
 		return *reinterpret_cast<const T *>(p_ptr);
 	}
 	typedef T EncodeT;
+	// p_val is a copy (or the returned value itself), so moving it saves reference counting and
+	// leaves the result exclusively owned, avoiding a copy-on-write duplication when it is written to.
 	_FORCE_INLINE_ static void encode(T p_val, void *p_ptr) {
-		*((T *)p_ptr) = p_val;
+		*((T *)p_ptr) = std::move(p_val);
 	}
 };
 
@@ -34,6 +34,7 @@
 #include "core/debugger/engine_debugger.h"
 #include "core/io/compression.h"
 #include "core/io/marshalls.h"
+#include "core/math/vector3_batch.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
 #include "core/templates/a_hash_map.h"
@@ -1068,6 +1069,43 @@ struct _VariantCall {
 		return dest;
 	}
 
+	static AABB func_PackedVector3Array_get_aabb(PackedVector3Array *p_instance) {
+		return Vector3Batch::get_aabb(p_instance->ptr(), p_instance->size());
+	}
+
+	static PackedVector3Array func_PackedVector3Array_normalized(PackedVector3Array *p_instance) {
+		PackedVector3Array dest;
+		dest.resize(p_instance->size());
+		Vector3Batch::normalize(p_instance->ptr(), dest.ptrw(), dest.size());
+		return dest;
+	}
+
+	static PackedFloat64Array func_PackedVector3Array_dot(PackedVector3Array *p_instance, const PackedVector3Array &p_with) {
+		PackedFloat64Array dest;
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_with.size(), dest, "Both PackedVector3Array must have the same size.");
+		dest.resize(p_instance->size());
+#ifdef REAL_T_IS_DOUBLE
+		Vector3Batch::dot(p_instance->ptr(), p_with.ptr(), dest.ptrw(), dest.size());
+#else
+		LocalVector<real_t> dots;
+		dots.resize(dest.size());
+		Vector3Batch::dot(p_instance->ptr(), p_with.ptr(), dots.ptr(), dots.size());
+		double *w = dest.ptrw();
+		for (uint32_t i = 0; i < dots.size(); i++) {
+			w[i] = dots[i];
+		}
+#endif
+		return dest;
+	}
+
+	static PackedVector3Array func_PackedVector3Array_cross(PackedVector3Array *p_instance, const PackedVector3Array &p_with) {
+		PackedVector3Array dest;
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_with.size(), dest, "Both PackedVector3Array must have the same size.");
+		dest.resize(p_instance->size());
+		Vector3Batch::cross(p_instance->ptr(), p_with.ptr(), dest.ptrw(), dest.size());
+		return dest;
+	}
+
 	static void func_PackedByteArray_encode_u8(PackedByteArray *p_instance, int64_t p_offset, int64_t p_value) {
 		uint64_t size = p_instance->size();
 		ERR_FAIL_COND(p_offset < 0 || p_offset > int64_t(size) - 1);
@@ -2807,6 +2845,10 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
 	bind_method(PackedVector3Array, erase, sarray("value"), varray());
+	bind_function(PackedVector3Array, get_aabb, _VariantCall::func_PackedVector3Array_get_aabb, sarray(), varray());
+	bind_function(PackedVector3Array, normalized, _VariantCall::func_PackedVector3Array_normalized, sarray(), varray());
+	bind_function(PackedVector3Array, dot, _VariantCall::func_PackedVector3Array_dot, sarray("with"), varray());
+	bind_function(PackedVector3Array, cross, _VariantCall::func_PackedVector3Array_cross, sarray("with"), varray());
 
 	/* Color Array */
 
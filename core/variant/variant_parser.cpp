@@ -274,7 +274,8 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 				[[fallthrough]];
 			}
 			case '"': {
-				String str;
+				// Most strings fit in the buffer's inline storage, and are allocated once when done.
+				StringBuffer<> str_buffer;
 				char32_t prev = 0;
 				while (true) {
 					char32_t ch = p_stream->get_char();
@@ -377,7 +378,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 							r_token.type = TK_ERROR;
 							return ERR_PARSE_ERROR;
 						}
-						str += res;
+						str_buffer += res;
 					} else {
 						if (prev != 0) {
 							r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
@@ -387,7 +388,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 						if (ch == '\n') {
 							line++;
 						}
-						str += ch;
+						str_buffer += ch;
 					}
 				}
 				if (prev != 0) {
@@ -396,6 +397,7 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					return ERR_PARSE_ERROR;
 				}
 
+				String str = str_buffer.as_string();
 				if (p_stream->is_utf8()) {
 					// Re-interpret the string we built as ascii.
 					CharString string_as_ascii = str.ascii(true);
@@ -780,6 +780,9 @@ Error GDScript::reload(bool p_keep_state) {
 	}
 #endif
 
+	// Exported scripts have usually been parsed and analyzed already by the cache while resolving
+	// dependencies, so that tree can be compiled directly instead of doing all the work again.
+	Ref<GDScriptParserRef> cached_parser_ref;
 	{
 		String source_path = path;
 		if (source_path.is_empty()) {
@@ -802,6 +805,8 @@ Error GDScript::reload(bool p_keep_state) {
 					}
 					if (parser_ref->get_source_hash() != source_hash) {
 						GDScriptCache::remove_parser(source_path);
+					} else if (!binary_tokens.is_empty()) {
+						cached_parser_ref = parser_ref;
 					}
 				}
 			}
@@ -817,14 +822,23 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	valid = false;
-	GDScriptParser parser;
+	GDScriptFunction::invalidate_inline_caches();
+	GDScriptParser local_parser;
+	GDScriptParser &parser = cached_parser_ref.is_valid() ? *cached_parser_ref->get_parser() : local_parser;
 	Error err;
-	if (!binary_tokens.is_empty()) {
+	if (cached_parser_ref.is_valid()) {
+		err = cached_parser_ref->raise_status(GDScriptParserRef::PARSED);
+	} else if (!binary_tokens.is_empty()) {
 		err = parser.parse_binary(binary_tokens, path);
 	} else {
 		err = parser.parse(source, path, false);
 	}
 	if (err) {
+		if (parser.get_errors().is_empty()) {
+			// The cached parser can fail to raise its status without recording a parser error, e.g. with ERR_BUG.
+			reloading = false;
+			return err;
+		}
 		if (EngineDebugger::is_active()) {
 			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
 		}
@@ -834,10 +848,22 @@ Error GDScript::reload(bool p_keep_state) {
 		return ERR_PARSE_ERROR;
 	}
 
-	GDScriptAnalyzer analyzer(&parser);
-	err = analyzer.analyze();
+	if (cached_parser_ref.is_valid()) {
+		err = cached_parser_ref->raise_status(GDScriptParserRef::FULLY_SOLVED);
+		if (!err) {
+			err = cached_parser_ref->get_analyzer()->resolve_dependencies();
+		}
+	} else {
+		GDScriptAnalyzer analyzer(&parser);
+		err = analyzer.analyze();
+	}
 
 	if (err) {
+		if (parser.get_errors().is_empty()) {
+			// Same as above.
+			reloading = false;
+			return err;
+		}
 		if (EngineDebugger::is_active()) {
 			GDScriptLanguage::get_singleton()->debug_break_parse(_get_debug_path(), parser.get_errors().front()->get().line, "Parser Error: " + parser.get_errors().front()->get().message);
 		}
@@ -1563,6 +1589,8 @@ void GDScript::clear(ClearData *p_clear_data) {
 		}
 	}
 
+	GDScriptFunction::invalidate_inline_caches();
+
 	// If we're in the process of shutting things down then every single script will be cleared
 	// anyway, so we can safely skip this very costly operation.
 	if (!GDScriptLanguage::singleton->finishing) {
@@ -466,6 +466,7 @@ class GDScriptLanguage : public ScriptLanguage {
 	friend class GDScriptFunction;
 
 	SelfList<GDScriptFunction>::List function_list;
+	SelfList<GDScriptFunction>::List inline_cache_function_list; // Functions with inline caches, in all builds.
 #ifdef DEBUG_ENABLED
 	bool profiling;
 	bool profile_native_calls;
@@ -183,6 +183,8 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 #endif
 	append_opcode(GDScriptFunction::OPCODE_END);
 
+	thread_jumps();
+
 	for (int i = 0; i < temporaries.size(); i++) {
 		int stack_index = i + max_locals + GDScriptFunction::FIXED_ADDRESSES_MAX;
 		for (int j = 0; j < temporaries[i].bytecode_indices.size(); j++) {
@@ -228,6 +230,10 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		function->_code_size = 0;
 	}
 
+	if (inline_cache_count) {
+		function->_create_inline_caches(inline_cache_count);
+	}
+
 	if (function->default_arguments.size()) {
 		function->_default_arg_count = function->default_arguments.size() - 1;
 		function->_default_arg_ptr = &function->default_arguments[0];
@@ -613,6 +619,25 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		if (p_target.mode == Address::TEMPORARY && p_left_operand.type.builtin_type == p_right_operand.type.builtin_type && (p_left_operand.type.builtin_type == Variant::INT || p_left_operand.type.builtin_type == Variant::FLOAT)) {
+			switch (p_operator) {
+				case Variant::OP_EQUAL:
+				case Variant::OP_NOT_EQUAL:
+				case Variant::OP_LESS:
+				case Variant::OP_LESS_EQUAL:
+				case Variant::OP_GREATER:
+				case Variant::OP_GREATER_EQUAL:
+					// Can be fused with a conditional jump on the result, see `append_jump_if_not()`.
+					fusable_compare_pos = opcodes.size();
+					fusable_compare_temp = p_target.address;
+					fusable_compare_op = p_operator;
+					fusable_compare_type = p_left_operand.type.builtin_type;
+					break;
+				default:
+					break;
+			}
+		}
+
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -690,18 +715,52 @@ void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const A
 	}
 }
 
-void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
+int GDScriptByteCodeGenerator::append_jump_if_not(const Address &p_condition) {
+	// A typed comparison whose result is only used by this jump can be merged into it. Both instructions
+	// are 5 words long and share the operand slots, so it's rewritten in place.
+	if (fusable_compare_pos >= 0 && fusable_compare_pos + 5 == opcodes.size() && p_condition.mode == Address::TEMPORARY && int(p_condition.address) == fusable_compare_temp) {
+		const int pos = fusable_compare_pos;
+		fusable_compare_pos = -1;
+
+		// The result slot goes away, so don't let it be resolved as a temporary address later.
+		Vector<int> &indices = temporaries.write[fusable_compare_temp].bytecode_indices;
+		if (!indices.is_empty() && indices[indices.size() - 1] == pos + 3) {
+			indices.remove_at(indices.size() - 1);
+
+			opcodes.write[pos] = fusable_compare_type == Variant::INT ? GDScriptFunction::OPCODE_JUMP_IF_NOT_COMPARE_INT : GDScriptFunction::OPCODE_JUMP_IF_NOT_COMPARE_FLOAT;
+			opcodes.write[pos + 3] = fusable_compare_op;
+			opcodes.write[pos + 4] = 0; // Jump destination, will be patched.
+			return pos + 4;
+		}
+	}
+
 	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_left_operand);
-	logic_op_jump_pos1.push_back(opcodes.size());
-	append(0); // Jump target, will be patched.
+	append(p_condition);
+	int jump_addr = opcodes.size();
+	append(0); // Jump destination, will be patched.
+	return jump_addr;
+}
+
+void GDScriptByteCodeGenerator::thread_jumps() {
+	// A jump landing on an unconditional jump can go straight to the final destination.
+	for (int jump_addr : patched_jumps) {
+		int to = opcodes[jump_addr];
+		for (int i = 0; i < 8 && to < opcodes.size() && opcodes[to] == GDScriptFunction::OPCODE_JUMP; i++) {
+			if (opcodes[to + 1] == to) {
+				break; // Infinite empty loop.
+			}
+			to = opcodes[to + 1];
+		}
+		opcodes.write[jump_addr] = to;
+	}
+}
+
+void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
+	logic_op_jump_pos1.push_back(append_jump_if_not(p_left_operand));
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_right_operand);
-	logic_op_jump_pos2.push_back(opcodes.size());
-	append(0); // Jump target, will be patched.
+	logic_op_jump_pos2.push_back(append_jump_if_not(p_right_operand));
 }
 
 void GDScriptByteCodeGenerator::write_end_and(const Address &p_target) {
@@ -755,10 +814,7 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
-	ternary_jump_fail_pos.push_back(opcodes.size());
-	append(0); // Jump target, will be patched.
+	ternary_jump_fail_pos.push_back(append_jump_if_not(p_condition));
 }
 
 void GDScriptByteCodeGenerator::write_ternary_true_expr(const Address &p_expr) {
@@ -859,6 +915,7 @@ void GDScriptByteCodeGenerator::write_set_named(const Address &p_target, const S
 	append(p_target);
 	append(p_source);
 	append(p_name);
+	append(inline_cache_count++);
 }
 
 void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) {
@@ -877,6 +934,7 @@ void GDScriptByteCodeGenerator::write_get_named(const Address &p_target, const S
 	append(p_source);
 	append(p_target);
 	append(p_name);
+	append(inline_cache_count++);
 }
 
 void GDScriptByteCodeGenerator::write_set_member(const Address &p_value, const StringName &p_name) {
@@ -891,6 +949,35 @@ void GDScriptByteCodeGenerator::write_get_member(const Address &p_target, const
 	append(p_name);
 }
 
+void GDScriptByteCodeGenerator::write_member_operator(const StringName &p_name, Variant::Operator p_operator, const Address &p_right_operand, const GDScriptDataType &p_member_type, const GDScriptDataType &p_result_type) {
+	// Compound assignments to native properties, like `position += velocity`, are common in game loops.
+	// With known types, the get, operator and set are fused, and the intermediate values never hit a temporary.
+	Variant::ValidatedOperatorEvaluator op_func = nullptr;
+	if (p_member_type.has_type && p_member_type.kind == GDScriptDataType::BUILTIN && HAS_BUILTIN_TYPE(p_right_operand) && p_operator != Variant::OP_DIVIDE && p_operator != Variant::OP_MODULE) {
+		op_func = Variant::get_validated_operator_evaluator(p_operator, p_member_type.builtin_type, p_right_operand.type.builtin_type);
+	}
+
+	if (op_func) {
+		append_opcode(GDScriptFunction::OPCODE_OPERATOR_MEMBER_VALIDATED);
+		append(p_right_operand);
+		append(p_name);
+		append(op_func);
+		append(Variant::get_operator_return_type(p_operator, p_member_type.builtin_type, p_right_operand.type.builtin_type));
+#ifdef DEBUG_ENABLED
+		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
+#endif
+		return;
+	}
+
+	Address op_result(Address::TEMPORARY, add_temporary(p_result_type), p_result_type);
+	Address member(Address::TEMPORARY, add_temporary(p_member_type), p_member_type);
+	write_get_member(member, p_name);
+	write_binary_operator(op_result, p_operator, member, p_right_operand);
+	pop_temporary(); // Member.
+	write_set_member(op_result, p_name);
+	pop_temporary(); // Operator result.
+}
+
 void GDScriptByteCodeGenerator::write_set_static_variable(const Address &p_value, const Address &p_class, int p_index) {
 	append_opcode(GDScriptFunction::OPCODE_SET_STATIC_VARIABLE);
 	append(p_value);
@@ -1091,6 +1178,7 @@ void GDScriptByteCodeGenerator::write_call(const Address &p_target, const Addres
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1116,6 +1204,7 @@ void GDScriptByteCodeGenerator::write_call_async(const Address &p_target, const
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1350,6 +1439,7 @@ void GDScriptByteCodeGenerator::write_call_self(const Address &p_target, const S
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1363,6 +1453,7 @@ void GDScriptByteCodeGenerator::write_call_self_async(const Address &p_target, c
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1376,6 +1467,7 @@ void GDScriptByteCodeGenerator::write_call_script_function(const Address &p_targ
 	append(ct.target);
 	append(p_arguments.size());
 	append(p_function_name);
+	append(inline_cache_count++);
 	ct.cleanup();
 }
 
@@ -1510,10 +1602,7 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
-	if_jmp_addrs.push_back(opcodes.size());
-	append(0); // Jump destination, will be patched.
+	if_jmp_addrs.push_back(append_jump_if_not(p_condition));
 }
 
 void GDScriptByteCodeGenerator::write_else() {
@@ -1786,10 +1875,7 @@ void GDScriptByteCodeGenerator::start_while_condition() {
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
-	while_jmp_addrs.push_back(opcodes.size());
-	append(0); // End of loop address, will be patched.
+	while_jmp_addrs.push_back(append_jump_if_not(p_condition));
 }
 
 void GDScriptByteCodeGenerator::write_endwhile() {
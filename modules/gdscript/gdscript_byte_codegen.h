@@ -97,6 +97,7 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int max_locals = 0;
 	int current_line = 0;
 	int instr_args_max = 0;
+	int inline_cache_count = 0;
 
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
@@ -158,6 +159,15 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	List<int> ternary_jump_fail_pos;
 	List<int> ternary_jump_skip_pos;
 
+	// Last typed comparison written into a temporary, so a conditional jump right after it can be fused.
+	int fusable_compare_pos = -1;
+	int fusable_compare_temp = -1;
+	Variant::Operator fusable_compare_op = Variant::OP_MAX;
+	Variant::Type fusable_compare_type = Variant::NIL;
+
+	// Jump destinations patched so far, threaded through chained jumps when the function ends.
+	Vector<int> patched_jumps;
+
 	List<List<int>> current_breaks_to_patch;
 
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
@@ -451,8 +461,14 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		patched_jumps.push_back(p_address);
+		// Something can jump between the last comparison and the next instruction now.
+		fusable_compare_pos = -1;
 	}
 
+	int append_jump_if_not(const Address &p_condition);
+	void thread_jumps();
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
@@ -500,6 +516,7 @@ public:
 	virtual void write_get_named(const Address &p_target, const StringName &p_name, const Address &p_source) override;
 	virtual void write_set_member(const Address &p_value, const StringName &p_name) override;
 	virtual void write_get_member(const Address &p_target, const StringName &p_name) override;
+	virtual void write_member_operator(const StringName &p_name, Variant::Operator p_operator, const Address &p_right_operand, const GDScriptDataType &p_member_type, const GDScriptDataType &p_result_type) override;
 	virtual void write_set_static_variable(const Address &p_value, const Address &p_class, int p_index) override;
 	virtual void write_get_static_variable(const Address &p_target, const Address &p_class, int p_index) override;
 	virtual void write_assign(const Address &p_target, const Address &p_source) override;
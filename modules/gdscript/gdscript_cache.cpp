@@ -77,7 +77,12 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 				status = PARSED;
 				String remapped_path = ResourceLoader::path_remap(path);
 				if (remapped_path.get_extension().to_lower() == "gdc") {
-					Vector<uint8_t> tokens = GDScriptCache::get_binary_tokens(remapped_path);
+					// The script is usually loaded already, so avoid reading the file again.
+					Ref<GDScript> script = GDScriptCache::get_cached_script(path);
+					Vector<uint8_t> tokens = script.is_valid() ? script->get_binary_tokens_source() : Vector<uint8_t>();
+					if (tokens.is_empty()) {
+						tokens = GDScriptCache::get_binary_tokens(remapped_path);
+					}
 					source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
 					result = get_parser()->parse_binary(tokens, path);
 				} else {
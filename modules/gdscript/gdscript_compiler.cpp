@@ -1254,27 +1254,18 @@ GDScriptCodeGenerator::Address GDScriptCompiler::_parse_expression(CodeGen &code
 					return GDScriptCodeGenerator::Address();
 				}
 
-				GDScriptCodeGenerator::Address to_assign = assigned_value;
 				bool has_operation = assignment->operation != GDScriptParser::AssignmentNode::OP_NONE;
 
 				StringName name = static_cast<GDScriptParser::IdentifierNode *>(assignment->assignee)->name;
 
 				if (has_operation) {
-					GDScriptCodeGenerator::Address op_result = codegen.add_temporary(_gdtype_from_datatype(assignment->get_datatype(), codegen.script));
-					GDScriptCodeGenerator::Address member = codegen.add_temporary(_gdtype_from_datatype(assignment->assignee->get_datatype(), codegen.script));
-					gen->write_get_member(member, name);
-					gen->write_binary_operator(op_result, assignment->variant_op, member, assigned_value);
-					gen->pop_temporary(); // Pop member temp.
-					to_assign = op_result;
+					gen->write_member_operator(name, assignment->variant_op, assigned_value, _gdtype_from_datatype(assignment->assignee->get_datatype(), codegen.script), _gdtype_from_datatype(assignment->get_datatype(), codegen.script));
+				} else {
+					gen->write_set_member(assigned_value, name);
 				}
 
-				gen->write_set_member(to_assign, name);
-
-				if (to_assign.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
-					gen->pop_temporary(); // Pop the assigned expression or the temp result if it has operation.
-				}
-				if (has_operation && assigned_value.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
-					gen->pop_temporary(); // Pop the assigned expression if not done before.
+				if (assigned_value.mode == GDScriptCodeGenerator::Address::TEMPORARY) {
+					gen->pop_temporary(); // Pop the assigned expression.
 				}
 			} else {
 				// Regular assignment.
@@ -2731,6 +2722,7 @@ Error GDScriptCompiler::_prepare_compilation(GDScript *p_script, const GDScriptP
 		member_functions.insert(E.key, E.value);
 	}
 	p_script->member_functions.clear();
+	GDScriptFunction::invalidate_inline_caches();
 	for (const KeyValue<StringName, GDScriptFunction *> &E : member_functions) {
 		memdelete(E.value);
 	}
@@ -112,10 +112,17 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 		Opcode opcode = Opcode(_code_ptr[ip]);
 
 		switch (opcode) {
-			case OPCODE_OPERATOR: {
+			case OPCODE_OPERATOR:
+			case OPCODE_OPERATOR_INT:
+			case OPCODE_OPERATOR_FLOAT: {
 				constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*_code_ptr);
 				int operation = _code_ptr[ip + 4];
 
+				if (_code_ptr[ip] == OPCODE_OPERATOR_INT) {
+					text += "int ";
+				} else if (_code_ptr[ip] == OPCODE_OPERATOR_FLOAT) {
+					text += "float ";
+				}
 				text += "operator ";
 
 				text += DADDR(3);
@@ -308,7 +315,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += "\"] = ";
 				text += DADDR(2);
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_SET_NAMED_VALIDATED: {
 				text += "set_named validated ";
@@ -329,7 +336,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				text += _global_names_ptr[_code_ptr[ip + 3]];
 				text += "\"]";
 
-				incr += 4;
+				incr += 5;
 			} break;
 			case OPCODE_GET_NAMED_VALIDATED: {
 				text += "get_named validated ";
@@ -361,6 +368,17 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 3;
 			} break;
+			case OPCODE_OPERATOR_MEMBER_VALIDATED: {
+				text += "validated member operator ";
+				text += "[\"";
+				text += _global_names_ptr[_code_ptr[ip + 2]];
+				text += "\"] ";
+				text += operator_names[_code_ptr[ip + 3]];
+				text += "= ";
+				text += DADDR(1);
+
+				incr += 5;
+			} break;
 			case OPCODE_SET_STATIC_VARIABLE: {
 				Ref<GDScript> gdscript;
 				if (_code_ptr[ip + 2] == ADDR_CLASS) {
@@ -708,7 +726,7 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 				}
 				text += ")";
 
-				incr = 5 + argc;
+				incr = 6 + argc;
 			} break;
 			case OPCODE_CALL_METHOD_BIND:
 			case OPCODE_CALL_METHOD_BIND_RET: {
@@ -1058,6 +1076,19 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr = 3;
 			} break;
+			case OPCODE_JUMP_IF_NOT_COMPARE_INT:
+			case OPCODE_JUMP_IF_NOT_COMPARE_FLOAT: {
+				text += _code_ptr[ip] == OPCODE_JUMP_IF_NOT_COMPARE_INT ? "jump-if-not int " : "jump-if-not float ";
+				text += DADDR(1);
+				text += " ";
+				text += Variant::get_operator_name(Variant::Operator(_code_ptr[ip + 3]));
+				text += " ";
+				text += DADDR(2);
+				text += " to ";
+				text += itos(_code_ptr[ip + 4]);
+
+				incr = 5;
+			} break;
 			case OPCODE_JUMP_TO_DEF_ARGUMENT: {
 				text += "jump-to-default-argument ";
 
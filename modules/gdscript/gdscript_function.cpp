@@ -114,9 +114,50 @@ GDScriptFunction::GDScriptFunction() {
 #endif
 }
 
+std::atomic<uint32_t> GDScriptFunction::inline_cache_epoch = 0;
+
+void GDScriptFunction::invalidate_inline_caches() {
+	MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
+	inline_cache_epoch.fetch_add(1, std::memory_order_relaxed);
+
+	for (SelfList<GDScriptFunction> *E = GDScriptLanguage::get_singleton()->inline_cache_function_list.first(); E; E = E->next()) {
+		GDScriptFunction *function = E->self();
+		for (InlineCacheEntry *entry : function->retired_inline_cache_entries) {
+			memdelete(entry);
+		}
+		function->retired_inline_cache_entries.clear();
+
+		for (int i = 0; i < function->_inline_cache_count; i++) {
+			InlineCache &cache = function->_inline_caches_ptr[i];
+			for (int j = 0; j < InlineCache::SIZE; j++) {
+				InlineCacheEntry *entry = cache.entries[j].exchange(nullptr, std::memory_order_acq_rel);
+				if (entry) {
+					function->retired_inline_cache_entries.push_back(entry);
+				}
+			}
+		}
+	}
+}
+
+void GDScriptFunction::_create_inline_caches(int p_count) {
+	_inline_caches_ptr = memnew_arr(InlineCache, p_count);
+	_inline_cache_count = p_count;
+	MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
+	GDScriptLanguage::get_singleton()->inline_cache_function_list.add(&inline_cache_function_list);
+}
+
 GDScriptFunction::~GDScriptFunction() {
 	get_script()->member_functions.erase(name);
 
+	if (_inline_caches_ptr) {
+		MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
+		GDScriptLanguage::get_singleton()->inline_cache_function_list.remove(&inline_cache_function_list);
+		memdelete_arr(_inline_caches_ptr);
+		for (InlineCacheEntry *entry : retired_inline_cache_entries) {
+			memdelete(entry);
+		}
+	}
+
 	for (int i = 0; i < lambdas.size(); i++) {
 		memdelete(lambdas[i]);
 	}
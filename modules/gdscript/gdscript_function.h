@@ -34,12 +34,16 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
 
+#include <atomic>
+
 class GDScriptInstance;
 class GDScript;
 
@@ -269,6 +273,8 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_INT, // Only set at runtime, from OPCODE_OPERATOR in hot functions.
+		OPCODE_OPERATOR_FLOAT, // Only set at runtime, from OPCODE_OPERATOR in hot functions.
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
@@ -286,6 +292,7 @@ public:
 		OPCODE_GET_NAMED_VALIDATED,
 		OPCODE_SET_MEMBER,
 		OPCODE_GET_MEMBER,
+		OPCODE_OPERATOR_MEMBER_VALIDATED, // Fused get, typed operator and set of a native member property.
 		OPCODE_SET_STATIC_VARIABLE, // Only for GDScript.
 		OPCODE_GET_STATIC_VARIABLE, // Only for GDScript.
 		OPCODE_ASSIGN,
@@ -329,6 +336,8 @@ public:
 		OPCODE_JUMP,
 		OPCODE_JUMP_IF,
 		OPCODE_JUMP_IF_NOT,
+		OPCODE_JUMP_IF_NOT_COMPARE_INT, // Fused typed comparison and conditional jump.
+		OPCODE_JUMP_IF_NOT_COMPARE_FLOAT,
 		OPCODE_JUMP_TO_DEF_ARGUMENT,
 		OPCODE_JUMP_IF_SHARED,
 		OPCODE_RETURN,
@@ -427,6 +436,10 @@ public:
 		OPCODE_END
 	};
 
+	// Calls plus loop iterations after which a function is considered hot, and its
+	// generic operators get specialized for the operand types seen so far.
+	static constexpr uint32_t HOT_THRESHOLD = 1000;
+
 	enum Address {
 		ADDR_BITS = 24,
 		ADDR_MASK = ((1 << ADDR_BITS) - 1),
@@ -460,6 +473,52 @@ private:
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
 
+	// Per call site cache for untyped named access and calls (OPCODE_GET_NAMED, OPCODE_SET_NAMED and OPCODE_CALL),
+	// keyed on the receiver's script and native class. Entries are never modified once published, so the VM can
+	// read them without locking while other threads fill the cache.
+	struct InlineCacheEntry {
+		enum Kind {
+			KIND_GENERIC, // Receiver seen, but it needs the regular lookup.
+			KIND_MEMBER,
+			KIND_SCRIPT_FUNCTION,
+			KIND_METHOD_BIND,
+		};
+
+		Kind kind = KIND_GENERIC;
+		const GDScript *script = nullptr;
+		StringName native_class;
+		uint32_t epoch = 0;
+
+		int member_index = -1;
+		Variant::Type member_type = Variant::VARIANT_MAX; // Only checked when setting, VARIANT_MAX if untyped.
+		GDScriptFunction *function = nullptr;
+		MethodBind *method = nullptr;
+	};
+
+	struct InlineCache {
+		static constexpr int SIZE = 4; // Sites seeing more receivers than this use the regular lookup.
+		std::atomic<InlineCacheEntry *> entries[SIZE] = {};
+
+		~InlineCache() {
+			for (int i = 0; i < SIZE; i++) {
+				InlineCacheEntry *entry = entries[i].load(std::memory_order_relaxed);
+				if (entry) {
+					memdelete(entry);
+				}
+			}
+		}
+	};
+
+	enum InlineCacheAccess {
+		INLINE_CACHE_GET,
+		INLINE_CACHE_SET,
+		INLINE_CACHE_CALL,
+	};
+
+	// Bumped whenever script functions or members may be freed (reload, clear), which invalidates every entry.
+	static std::atomic<uint32_t> inline_cache_epoch;
+	static void invalidate_inline_caches();
+
 	StringName name;
 	StringName source;
 	bool _static = false;
@@ -474,6 +533,7 @@ private:
 	int _vararg_index = -1;
 	int _stack_size = 0;
 	int _instruction_args_size = 0;
+	std::atomic<uint32_t> _hotness = 0; // Approximate, it's only a heuristic so it's counted with relaxed ordering.
 
 	SelfList<GDScriptFunction> function_list{ this };
 	mutable Variant nil;
@@ -534,6 +594,14 @@ private:
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
 
+	InlineCache *_inline_caches_ptr = nullptr;
+	int _inline_cache_count = 0;
+	// Entries are only taken out of the caches by invalidate_inline_caches(), under the language mutex. A lookup
+	// on another thread may still be reading one then, so they are kept until the next invalidation.
+	LocalVector<InlineCacheEntry *> retired_inline_cache_entries;
+	SelfList<GDScriptFunction> inline_cache_function_list{ this };
+	void _create_inline_caches(int p_count);
+
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
 	const char *_func_cname = nullptr;
@@ -571,6 +639,11 @@ private:
 	String _get_callable_call_error(const String &p_where, const Callable &p_callable, const Variant **p_argptrs, int p_argcount, const Variant &p_ret, const Callable::CallError &p_err) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
+	const InlineCacheEntry *_get_inline_cache_entry(int p_cache, Object *p_object, const StringName &p_name, InlineCacheAccess p_access);
+	void _inline_cache_call(int p_cache, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+	bool _inline_cache_get(int p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret);
+	bool _inline_cache_set(int p_cache, Variant *p_base, const StringName &p_name, const Variant &p_value);
+
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
 
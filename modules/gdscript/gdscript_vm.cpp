@@ -33,6 +33,7 @@
 #include "gdscript_lambda_callable.h"
 
 #include "core/os/os.h"
+#include "scene/scene_string_names.h"
 
 #ifdef DEBUG_ENABLED
 
@@ -207,6 +208,187 @@ String GDScriptFunction::_get_callable_call_error(const String &p_where, const C
 	}
 }
 
+const GDScriptFunction::InlineCacheEntry *GDScriptFunction::_get_inline_cache_entry(int p_cache, Object *p_object, const StringName &p_name, InlineCacheAccess p_access) {
+	GDScript *script = nullptr;
+	ScriptInstance *script_instance = p_object->get_script_instance();
+	if (script_instance) {
+		if (script_instance->is_placeholder() || script_instance->get_language() != GDScriptLanguage::get_singleton()) {
+			return nullptr;
+		}
+		script = static_cast<GDScriptInstance *>(script_instance)->script.ptr();
+	}
+	const StringName &native_class = p_object->get_class_name();
+	const uint32_t epoch = inline_cache_epoch.load(std::memory_order_relaxed);
+
+	InlineCache &cache = _inline_caches_ptr[p_cache];
+	int free_slot = -1;
+	for (int i = 0; i < InlineCache::SIZE; i++) {
+		InlineCacheEntry *entry = cache.entries[i].load(std::memory_order_acquire);
+		if (entry == nullptr) {
+			if (free_slot < 0) {
+				free_slot = i;
+			}
+			continue;
+		}
+		// Entries from an older epoch were filled while caches were being invalidated. They can't be freed
+		// here, since another thread may be reading them, so just skip them until the next invalidation.
+		if (entry->epoch == epoch && entry->script == script && entry->native_class == native_class) {
+			return entry->kind == InlineCacheEntry::KIND_GENERIC ? nullptr : entry;
+		}
+	}
+
+	if (free_slot < 0) {
+		return nullptr; // Megamorphic.
+	}
+
+	// Resolve the same way Object::get(), Object::set() and Object::callp() would.
+	InlineCacheEntry *entry = memnew(InlineCacheEntry);
+	entry->script = script;
+	entry->native_class = native_class;
+	entry->epoch = epoch;
+
+	switch (p_access) {
+		case INLINE_CACHE_GET:
+		case INLINE_CACHE_SET: {
+			if (script) {
+				// Only plain members, anything else (constants, static variables, `_get()`, `_set()`) is looked up as usual.
+				// Typed members are only cached when setting if a type check is enough.
+				HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(p_name);
+				if (E && p_access == INLINE_CACHE_GET && E->value.getter == StringName()) {
+					entry->kind = InlineCacheEntry::KIND_MEMBER;
+					entry->member_index = E->value.index;
+				} else if (E && p_access == INLINE_CACHE_SET && E->value.setter == StringName()) {
+					const GDScriptDataType &type = E->value.data_type;
+					if (!type.has_type || (type.kind == GDScriptDataType::BUILTIN && type.container_element_types.is_empty())) {
+						entry->kind = InlineCacheEntry::KIND_MEMBER;
+						entry->member_index = E->value.index;
+						entry->member_type = type.has_type ? type.builtin_type : Variant::VARIANT_MAX;
+					}
+				}
+			} else {
+				MethodBind *method = p_access == INLINE_CACHE_GET ? ClassDB::get_property_getter_method(native_class, p_name) : ClassDB::get_property_setter_method(native_class, p_name);
+				if (method) {
+					entry->kind = InlineCacheEntry::KIND_METHOD_BIND;
+					entry->method = method;
+				}
+			}
+		} break;
+		case INLINE_CACHE_CALL: {
+			if (p_name == CoreStringName(free_) || p_name == SceneStringName(_ready)) {
+				break; // Special cased by Object::callp() and GDScriptInstance::callp().
+			}
+			for (const GDScript *sptr = script; sptr; sptr = sptr->_base) {
+				if (likely(sptr->valid)) {
+					HashMap<StringName, GDScriptFunction *>::ConstIterator E = sptr->member_functions.find(p_name);
+					if (E) {
+						entry->kind = InlineCacheEntry::KIND_SCRIPT_FUNCTION;
+						entry->function = E->value;
+						break;
+					}
+				}
+			}
+			if (entry->kind == InlineCacheEntry::KIND_GENERIC) {
+				MethodBind *method = ClassDB::get_method(native_class, p_name);
+				if (method) {
+					entry->kind = InlineCacheEntry::KIND_METHOD_BIND;
+					entry->method = method;
+				}
+			}
+		} break;
+	}
+
+	if (entry->kind == InlineCacheEntry::KIND_METHOD_BIND) {
+		// Extension classes can be unloaded, taking their method binds with them.
+		ClassDB::APIType api = ClassDB::get_api_type(native_class);
+		if (api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION) {
+			entry->kind = InlineCacheEntry::KIND_GENERIC;
+			entry->method = nullptr;
+		}
+	}
+
+	InlineCacheEntry *expected = nullptr;
+	if (!cache.entries[free_slot].compare_exchange_strong(expected, entry, std::memory_order_release, std::memory_order_relaxed)) {
+		// Another thread filled this slot first, just do the regular lookup this time.
+		memdelete(entry);
+		return nullptr;
+	}
+
+	return entry->kind == InlineCacheEntry::KIND_GENERIC ? nullptr : entry;
+}
+
+void GDScriptFunction::_inline_cache_call(int p_cache, Variant *p_base, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	if (p_base->get_type() == Variant::OBJECT) {
+		Object *obj = p_base->get_validated_object();
+		const InlineCacheEntry *entry = obj ? _get_inline_cache_entry(p_cache, obj, p_method, INLINE_CACHE_CALL) : nullptr;
+		if (entry) {
+#ifdef DEBUG_ENABLED
+			_ObjectDebugLock debug_lock(obj); // Same as Object::callp().
+#endif
+			r_err.error = Callable::CallError::CALL_OK;
+			if (entry->kind == InlineCacheEntry::KIND_SCRIPT_FUNCTION) {
+				r_ret = entry->function->call(static_cast<GDScriptInstance *>(obj->get_script_instance()), p_args, p_argcount, r_err);
+			} else {
+				r_ret = entry->method->call(obj, p_args, p_argcount, r_err);
+			}
+			return;
+		}
+	}
+
+	p_base->callp(p_method, p_args, p_argcount, r_ret, r_err);
+}
+
+bool GDScriptFunction::_inline_cache_get(int p_cache, const Variant *p_base, const StringName &p_name, Variant &r_ret) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+	Object *obj = p_base->get_validated_object();
+	const InlineCacheEntry *entry = obj ? _get_inline_cache_entry(p_cache, obj, p_name, INLINE_CACHE_GET) : nullptr;
+	if (!entry) {
+		return false;
+	}
+
+	if (entry->kind == InlineCacheEntry::KIND_MEMBER) {
+		r_ret = static_cast<GDScriptInstance *>(obj->get_script_instance())->members[entry->member_index];
+	} else {
+		Callable::CallError ce;
+		r_ret = entry->method->call(obj, nullptr, 0, ce);
+	}
+	return true;
+}
+
+bool GDScriptFunction::_inline_cache_set(int p_cache, Variant *p_base, const StringName &p_name, const Variant &p_value) {
+	if (p_base->get_type() != Variant::OBJECT) {
+		return false;
+	}
+	Object *obj = p_base->get_validated_object();
+	const InlineCacheEntry *entry = obj ? _get_inline_cache_entry(p_cache, obj, p_name, INLINE_CACHE_SET) : nullptr;
+	if (!entry) {
+		return false;
+	}
+
+	if (entry->kind == InlineCacheEntry::KIND_MEMBER) {
+		if (entry->member_type != Variant::VARIANT_MAX && p_value.get_type() != entry->member_type) {
+			return false; // Needs a conversion, or fails.
+		}
+#ifdef TOOLS_ENABLED
+		obj->set_edited(true);
+#endif
+		static_cast<GDScriptInstance *>(obj->get_script_instance())->members.write[entry->member_index] = p_value;
+		return true;
+	}
+
+	const Variant *args[1] = { &p_value };
+	Callable::CallError ce;
+	entry->method->call(obj, args, 1, ce);
+	if (ce.error != Callable::CallError::CALL_OK) {
+		return false; // Let the regular path report the error.
+	}
+#ifdef TOOLS_ENABLED
+	obj->set_edited(true);
+#endif
+	return true;
+}
+
 void (*type_init_function_table[])(Variant *) = {
 	nullptr, // NIL (shouldn't be called).
 	&VariantInitializer<bool>::init, // BOOL.
@@ -254,6 +436,8 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_OPERATOR_INT,                           \
+		&&OPCODE_OPERATOR_FLOAT,                         \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_DICTIONARY,                   \
@@ -271,6 +455,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_GET_NAMED_VALIDATED,                    \
 		&&OPCODE_SET_MEMBER,                             \
 		&&OPCODE_GET_MEMBER,                             \
+		&&OPCODE_OPERATOR_MEMBER_VALIDATED,              \
 		&&OPCODE_SET_STATIC_VARIABLE,                    \
 		&&OPCODE_GET_STATIC_VARIABLE,                    \
 		&&OPCODE_ASSIGN,                                 \
@@ -314,6 +499,8 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_JUMP,                                   \
 		&&OPCODE_JUMP_IF,                                \
 		&&OPCODE_JUMP_IF_NOT,                            \
+		&&OPCODE_JUMP_IF_NOT_COMPARE_INT,                \
+		&&OPCODE_JUMP_IF_NOT_COMPARE_FLOAT,              \
 		&&OPCODE_JUMP_TO_DEF_ARGUMENT,                   \
 		&&OPCODE_JUMP_IF_SHARED,                         \
 		&&OPCODE_RETURN,                                 \
@@ -491,6 +678,65 @@ void (*type_init_function_table[])(Variant *) = {
 #define OP_GET_BASIS get_basis
 #define OP_GET_RID get_rid
 
+// The cached signature of OPCODE_OPERATOR is (a_type << 8) | b_type. This flag is added
+// on top of it once the site is known not to be worth specializing (or was deoptimized).
+static constexpr uint32_t OPERATOR_SIGNATURE_MASK = 0xFFFF;
+static constexpr uint32_t OPERATOR_NO_SPECIALIZE = 1 << 16;
+
+// Specialization rewrites code that other threads may be running. Each rewrite is serialized by this
+// mutex, and each changed word is replaced with a single atomic store, so concurrent readers always
+// see either the old or the new version of it, and both are valid for the operands that follow.
+static Mutex operator_specialization_mutex;
+
+static_assert(sizeof(std::atomic<int>) == sizeof(int) && std::atomic<int>::is_always_lock_free);
+
+static _FORCE_INLINE_ int _load_code_word(const int *p_word) {
+	return reinterpret_cast<const std::atomic<int> *>(p_word)->load(std::memory_order_relaxed);
+}
+
+static _FORCE_INLINE_ void _store_code_word(int *p_word, int p_value) {
+	reinterpret_cast<std::atomic<int> *>(p_word)->store(p_value, std::memory_order_release);
+}
+
+static _FORCE_INLINE_ bool _is_operator_specializable(Variant::Operator p_op) {
+	switch (p_op) {
+		case Variant::OP_ADD:
+		case Variant::OP_SUBTRACT:
+		case Variant::OP_MULTIPLY:
+		case Variant::OP_EQUAL:
+		case Variant::OP_NOT_EQUAL:
+		case Variant::OP_LESS:
+		case Variant::OP_LESS_EQUAL:
+		case Variant::OP_GREATER:
+		case Variant::OP_GREATER_EQUAL:
+			return true;
+		default:
+			return false;
+	}
+}
+
+// Write unboxed results, only reinitializing the destination when its type changes.
+static _FORCE_INLINE_ void _set_operator_result(Variant *r_dst, int64_t p_value) {
+	if (r_dst->get_type() != Variant::INT) {
+		VariantInternal::initialize(r_dst, Variant::INT);
+	}
+	*VariantInternal::get_int(r_dst) = p_value;
+}
+
+static _FORCE_INLINE_ void _set_operator_result(Variant *r_dst, double p_value) {
+	if (r_dst->get_type() != Variant::FLOAT) {
+		VariantInternal::initialize(r_dst, Variant::FLOAT);
+	}
+	*VariantInternal::get_float(r_dst) = p_value;
+}
+
+static _FORCE_INLINE_ void _set_operator_result(Variant *r_dst, bool p_value) {
+	if (r_dst->get_type() != Variant::BOOL) {
+		VariantInternal::initialize(r_dst, Variant::BOOL);
+	}
+	*VariantInternal::get_bool(r_dst) = p_value;
+}
+
 #define METHOD_CALL_ON_NULL_VALUE_ERROR(method_pointer) "Cannot call method '" + (method_pointer)->get_name() + "' on a null value."
 #define METHOD_CALL_ON_FREED_INSTANCE_ERROR(method_pointer) "Cannot call method '" + (method_pointer)->get_name() + "' on a previously freed instance."
 
@@ -503,6 +749,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 
 	r_err.error = Callable::CallError::CALL_OK;
 
+	if (unlikely(_hotness.load(std::memory_order_relaxed) < HOT_THRESHOLD)) {
+		_hotness.fetch_add(1, std::memory_order_relaxed);
+	}
+
 	static thread_local int call_depth = 0;
 	if (unlikely(++call_depth > MAX_CALL_DEPTH)) {
 		call_depth--;
@@ -797,7 +1047,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						}
 					}
 					initializer_mutex.unlock();
-				} else if (likely(op_signature == actual_signature)) {
+				} else if (likely((op_signature & OPERATOR_SIGNATURE_MASK) == actual_signature)) {
 					// If the signature matches, we can use the optimized path.
 					Variant::Type ret_type = static_cast<Variant::Type>(_code_ptr[ip + 6]);
 					Variant::ValidatedOperatorEvaluator op_func = *reinterpret_cast<Variant::ValidatedOperatorEvaluator *>(&_code_ptr[ip + 7]);
@@ -805,6 +1055,22 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					// Make sure the return value has the correct type.
 					VariantInternal::initialize(dst, ret_type);
 					op_func(a, b, dst);
+
+					if (unlikely(_hotness.load(std::memory_order_relaxed) >= HOT_THRESHOLD && !(op_signature & OPERATOR_NO_SPECIALIZE))) {
+						// The function is hot and this site only saw one signature so far. Switch to an unboxed
+						// version if there's one; it has the same layout, and deoptimizes itself if types change.
+						MutexLock lock(operator_specialization_mutex);
+						// Another thread may have rewritten or deoptimized this site in the meantime.
+						if (_load_code_word(&_code_ptr[ip]) == OPCODE_OPERATOR && !(_load_code_word(&_code_ptr[ip + 5]) & OPERATOR_NO_SPECIALIZE)) {
+							if (actual_signature == ((Variant::INT << 8) | Variant::INT) && _is_operator_specializable(op)) {
+								_store_code_word(&_code_ptr[ip], OPCODE_OPERATOR_INT);
+							} else if (actual_signature == ((Variant::FLOAT << 8) | Variant::FLOAT) && _is_operator_specializable(op)) {
+								_store_code_word(&_code_ptr[ip], OPCODE_OPERATOR_FLOAT);
+							} else {
+								_store_code_word(&_code_ptr[ip + 5], op_signature | OPERATOR_NO_SPECIALIZE);
+							}
+						}
+					}
 				} else {
 					// If the signature doesn't match, we have to use the slow path.
 #ifdef DEBUG_ENABLED
@@ -832,6 +1098,122 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_INT) {
+				constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*_code_ptr);
+				CHECK_SPACE(7 + _pointer_size);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				if (unlikely(a->get_type() != Variant::INT || b->get_type() != Variant::INT)) {
+					// Guard failed, deoptimize for good and let the generic opcode handle it.
+					{
+						// Scoped, since computed gotos don't run destructors.
+						MutexLock lock(operator_specialization_mutex);
+						_store_code_word(&_code_ptr[ip + 5], _load_code_word(&_code_ptr[ip + 5]) | OPERATOR_NO_SPECIALIZE);
+						_store_code_word(&_code_ptr[ip], OPCODE_OPERATOR);
+					}
+					DISPATCH_OPCODE;
+				}
+
+				const int64_t left = *VariantInternal::get_int(a);
+				const int64_t right = *VariantInternal::get_int(b);
+
+				switch ((Variant::Operator)_code_ptr[ip + 4]) {
+					case Variant::OP_ADD:
+						_set_operator_result(dst, int64_t(left + right));
+						break;
+					case Variant::OP_SUBTRACT:
+						_set_operator_result(dst, int64_t(left - right));
+						break;
+					case Variant::OP_MULTIPLY:
+						_set_operator_result(dst, int64_t(left * right));
+						break;
+					case Variant::OP_EQUAL:
+						_set_operator_result(dst, left == right);
+						break;
+					case Variant::OP_NOT_EQUAL:
+						_set_operator_result(dst, left != right);
+						break;
+					case Variant::OP_LESS:
+						_set_operator_result(dst, left < right);
+						break;
+					case Variant::OP_LESS_EQUAL:
+						_set_operator_result(dst, left <= right);
+						break;
+					case Variant::OP_GREATER:
+						_set_operator_result(dst, left > right);
+						break;
+					case Variant::OP_GREATER_EQUAL:
+						_set_operator_result(dst, left >= right);
+						break;
+					default:
+						GD_ERR_BREAK(true);
+				}
+
+				ip += 7 + _pointer_size;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_OPERATOR_FLOAT) {
+				constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*_code_ptr);
+				CHECK_SPACE(7 + _pointer_size);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				if (unlikely(a->get_type() != Variant::FLOAT || b->get_type() != Variant::FLOAT)) {
+					// Guard failed, deoptimize for good and let the generic opcode handle it.
+					{
+						// Scoped, since computed gotos don't run destructors.
+						MutexLock lock(operator_specialization_mutex);
+						_store_code_word(&_code_ptr[ip + 5], _load_code_word(&_code_ptr[ip + 5]) | OPERATOR_NO_SPECIALIZE);
+						_store_code_word(&_code_ptr[ip], OPCODE_OPERATOR);
+					}
+					DISPATCH_OPCODE;
+				}
+
+				const double left = *VariantInternal::get_float(a);
+				const double right = *VariantInternal::get_float(b);
+
+				switch ((Variant::Operator)_code_ptr[ip + 4]) {
+					case Variant::OP_ADD:
+						_set_operator_result(dst, double(left + right));
+						break;
+					case Variant::OP_SUBTRACT:
+						_set_operator_result(dst, double(left - right));
+						break;
+					case Variant::OP_MULTIPLY:
+						_set_operator_result(dst, double(left * right));
+						break;
+					case Variant::OP_EQUAL:
+						_set_operator_result(dst, left == right);
+						break;
+					case Variant::OP_NOT_EQUAL:
+						_set_operator_result(dst, left != right);
+						break;
+					case Variant::OP_LESS:
+						_set_operator_result(dst, left < right);
+						break;
+					case Variant::OP_LESS_EQUAL:
+						_set_operator_result(dst, left <= right);
+						break;
+					case Variant::OP_GREATER:
+						_set_operator_result(dst, left > right);
+						break;
+					case Variant::OP_GREATER_EQUAL:
+						_set_operator_result(dst, left >= right);
+						break;
+					default:
+						GD_ERR_BREAK(true);
+				}
+
+				ip += 7 + _pointer_size;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_OPERATOR_VALIDATED) {
 				CHECK_SPACE(5);
 
@@ -1193,7 +1575,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_SET_NAMED) {
-				CHECK_SPACE(3);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(dst, 0);
 				GET_VARIANT_PTR(value, 1);
@@ -1203,8 +1585,13 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-				dst->set_named(*index, *value, valid);
+				int inline_cache = _code_ptr[ip + 4];
+				GD_ERR_BREAK(inline_cache < 0 || inline_cache >= _inline_cache_count);
+
+				bool valid = _inline_cache_set(inline_cache, dst, *index, *value);
+				if (!valid) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1225,7 +1612,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					OPCODE_BREAK;
 				}
 #endif
-				ip += 4;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1245,7 +1632,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			DISPATCH_OPCODE;
 
 			OPCODE(OPCODE_GET_NAMED) {
-				CHECK_SPACE(4);
+				CHECK_SPACE(5);
 
 				GET_VARIANT_PTR(src, 0);
 				GET_VARIANT_PTR(dst, 1);
@@ -1255,22 +1642,23 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-#ifdef DEBUG_ENABLED
-				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+				int inline_cache = _code_ptr[ip + 4];
+				GD_ERR_BREAK(inline_cache < 0 || inline_cache >= _inline_cache_count);
 
-#else
-				*dst = src->get_named(*index, valid);
-#endif
+				// Always go through a temporary, src and dst can be the same stack position.
+				Variant ret;
+				bool valid = _inline_cache_get(inline_cache, src, *index, ret);
+				if (!valid) {
+					ret = src->get_named(*index, valid);
+				}
 #ifdef DEBUG_ENABLED
 				if (!valid) {
 					err_text = "Invalid access to property or key '" + index->operator String() + "' on a base object of type '" + _get_var_type(src) + "'.";
 					OPCODE_BREAK;
 				}
-				*dst = ret;
 #endif
-				ip += 4;
+				*dst = ret;
+				ip += 5;
 			}
 			DISPATCH_OPCODE;
 
@@ -1332,6 +1720,47 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_MEMBER_VALIDATED) {
+				CHECK_SPACE(5);
+				GET_VARIANT_PTR(b, 0);
+				int indexname = _code_ptr[ip + 2];
+				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
+				const StringName *index = &_global_names_ptr[indexname];
+				int operator_idx = _code_ptr[ip + 3];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				Variant member;
+#ifndef DEBUG_ENABLED
+				ClassDB::get_property(p_instance->owner, *index, member);
+#else
+				bool ok = ClassDB::get_property(p_instance->owner, *index, member);
+				if (!ok) {
+					err_text = "Internal error getting property: " + String(*index);
+					OPCODE_BREAK;
+				}
+#endif
+				Variant result;
+				VariantInternal::initialize(&result, (Variant::Type)_code_ptr[ip + 4]);
+				operator_func(&member, b, &result);
+
+				bool valid;
+#ifndef DEBUG_ENABLED
+				ClassDB::set_property(p_instance->owner, *index, result, &valid);
+#else
+				ok = ClassDB::set_property(p_instance->owner, *index, result, &valid);
+				if (!ok) {
+					err_text = "Internal error setting property: " + String(*index);
+					OPCODE_BREAK;
+				} else if (!valid) {
+					err_text = "Error setting property '" + String(*index) + "' with value of type " + Variant::get_type_name(result.get_type()) + ".";
+					OPCODE_BREAK;
+				}
+#endif
+				ip += 5;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_SET_STATIC_VARIABLE) {
 				CHECK_SPACE(4);
 
@@ -1889,7 +2318,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool call_async = (_code_ptr[ip]) == OPCODE_CALL_ASYNC;
 #endif
 				LOAD_INSTRUCTION_ARGS
-				CHECK_SPACE(3 + instr_arg_count);
+				CHECK_SPACE(4 + instr_arg_count);
 
 				ip += instr_arg_count;
 
@@ -1900,6 +2329,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(methodname_idx < 0 || methodname_idx >= _global_names_count);
 				const StringName *methodname = &_global_names_ptr[methodname_idx];
 
+				int inline_cache = _code_ptr[ip + 3];
+				GD_ERR_BREAK(inline_cache < 0 || inline_cache >= _inline_cache_count);
+
 				GET_INSTRUCTION_ARG(base, argc);
 				Variant **argptrs = instruction_args;
 
@@ -1918,7 +2350,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					_inline_cache_call(inline_cache, base, *methodname, (const Variant **)argptrs, argc, temp_ret, err);
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
@@ -1948,7 +2380,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					}
 #endif
 				} else {
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					_inline_cache_call(inline_cache, base, *methodname, (const Variant **)argptrs, argc, temp_ret, err);
 				}
 #ifdef DEBUG_ENABLED
 
@@ -2003,7 +2435,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				}
 #endif // DEBUG_ENABLED
 
-				ip += 3;
+				ip += 4;
 			}
 			DISPATCH_OPCODE;
 
@@ -2569,13 +3001,6 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
-					gdfs->state.stack.resize(alloca_size);
-
-					// First `FIXED_ADDRESSES_MAX` stack addresses are special, so we just skip them here.
-					for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
-						memnew_placement(&gdfs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
-					}
-					gdfs->state.stack_size = _stack_size;
 					gdfs->state.ip = ip + 2;
 					gdfs->state.line = line;
 					gdfs->state.script = _script;
@@ -2611,6 +3036,20 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 						OPCODE_BREAK;
 					}
 
+					// Move the frame into the state instead of copying it slot by slot. Variants are
+					// bitwise relocatable (CowData relies on this as well), so the source slots are
+					// simply not destructed when leaving the function. A frame that was already
+					// resumed from a state can hand over its buffer without touching it at all.
+					if (p_state) {
+						gdfs->state.stack = std::move(p_state->stack);
+						p_state->stack_size = 0;
+					} else {
+						gdfs->state.stack.resize(alloca_size);
+						// First `FIXED_ADDRESSES_MAX` stack addresses are special, so we just skip them here.
+						memcpy(gdfs->state.stack.ptrw() + sizeof(Variant) * FIXED_ADDRESSES_MAX, (const void *)&stack[FIXED_ADDRESSES_MAX], sizeof(Variant) * (_stack_size - FIXED_ADDRESSES_MAX));
+					}
+					gdfs->state.stack_size = _stack_size;
+
 					awaited = true;
 
 #ifdef DEBUG_ENABLED
@@ -2705,6 +3144,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				int to = _code_ptr[ip + 1];
 
 				GD_ERR_BREAK(to < 0 || to > _code_size);
+				if (to < ip && unlikely(_hotness.load(std::memory_order_relaxed) < HOT_THRESHOLD)) {
+					// Loop iterations count towards hotness too.
+					_hotness.fetch_add(1, std::memory_order_relaxed);
+				}
 				ip = to;
 			}
 			DISPATCH_OPCODE;
@@ -2743,6 +3186,93 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_JUMP_IF_NOT_COMPARE_INT) {
+				CHECK_SPACE(5);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+
+				// Operands are statically typed, like in OPCODE_OPERATOR_VALIDATED.
+				const int64_t left = *VariantInternal::get_int(a);
+				const int64_t right = *VariantInternal::get_int(b);
+
+				bool result = false;
+				switch ((Variant::Operator)_code_ptr[ip + 3]) {
+					case Variant::OP_EQUAL:
+						result = left == right;
+						break;
+					case Variant::OP_NOT_EQUAL:
+						result = left != right;
+						break;
+					case Variant::OP_LESS:
+						result = left < right;
+						break;
+					case Variant::OP_LESS_EQUAL:
+						result = left <= right;
+						break;
+					case Variant::OP_GREATER:
+						result = left > right;
+						break;
+					case Variant::OP_GREATER_EQUAL:
+						result = left >= right;
+						break;
+					default:
+						GD_ERR_BREAK(true);
+				}
+
+				if (!result) {
+					int to = _code_ptr[ip + 4];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 5;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_JUMP_IF_NOT_COMPARE_FLOAT) {
+				CHECK_SPACE(5);
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+
+				const double left = *VariantInternal::get_float(a);
+				const double right = *VariantInternal::get_float(b);
+
+				bool result = false;
+				switch ((Variant::Operator)_code_ptr[ip + 3]) {
+					case Variant::OP_EQUAL:
+						result = left == right;
+						break;
+					case Variant::OP_NOT_EQUAL:
+						result = left != right;
+						break;
+					case Variant::OP_LESS:
+						result = left < right;
+						break;
+					case Variant::OP_LESS_EQUAL:
+						result = left <= right;
+						break;
+					case Variant::OP_GREATER:
+						result = left > right;
+						break;
+					case Variant::OP_GREATER_EQUAL:
+						result = left >= right;
+						break;
+					default:
+						GD_ERR_BREAK(true);
+				}
+
+				if (!result) {
+					int to = _code_ptr[ip + 4];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 5;
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_JUMP_TO_DEF_ARGUMENT) {
 				CHECK_SPACE(2);
 				ip = _default_arg_ptr[defarg];
@@ -3975,9 +4505,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	if (!p_state || awaited) {
 		GDScriptLanguage::get_singleton()->exit_function();
 
-		// Free stack, except reserved addresses.
-		for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
-			stack[i].~Variant();
+		// Free stack, except reserved addresses. When awaiting, the slots were moved into the function state.
+		if (!awaited) {
+			for (int i = FIXED_ADDRESSES_MAX; i < _stack_size; i++) {
+				stack[i].~Variant();
+			}
 		}
 	}
 
@@ -32,7 +32,14 @@
 
 #include "gdscript_test_runner.h"
 
+#include "../gdscript_cache.h"
+#include "../gdscript_tokenizer_buffer.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "scene/2d/node_2d.h"
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 namespace GDScriptTests {
 
@@ -72,6 +79,204 @@ func _init():
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+TEST_CASE("[Modules][GDScript] Reloading a script invalidates inline caches of other scripts") {
+	GDScriptLanguage::get_singleton()->init();
+	Ref<GDScript> caller_script = memnew(GDScript);
+	caller_script->set_source_code(R"(
+extends RefCounted
+
+func read(obj):
+	return obj.value
+
+func call_get(obj):
+	return obj.get_value()
+)");
+	Ref<GDScript> callee_script = memnew(GDScript);
+	callee_script->set_source_code(R"(
+extends RefCounted
+
+var value = 1
+
+func get_value():
+	return 10
+)");
+	ERR_PRINT_OFF;
+	REQUIRE(caller_script->reload() == OK);
+	REQUIRE(callee_script->reload() == OK);
+	ERR_PRINT_ON;
+
+	Ref<RefCounted> caller = memnew(RefCounted);
+	caller->set_script(caller_script);
+	{
+		// Untyped access goes through the inline caches, which are filled by the first call.
+		Ref<RefCounted> callee = memnew(RefCounted);
+		callee->set_script(callee_script);
+		for (int i = 0; i < 2; i++) {
+			CHECK(int(caller->call("read", callee)) == 1);
+			CHECK(int(caller->call("call_get", callee)) == 10);
+		}
+	}
+
+	// Same script object, so stale entries would still match. The member also moves to another index.
+	callee_script->set_source_code(R"(
+extends RefCounted
+
+var other = 0
+var value = 2
+
+func get_value():
+	return 20
+)");
+	ERR_PRINT_OFF;
+	REQUIRE(callee_script->reload() == OK);
+	ERR_PRINT_ON;
+
+	Ref<RefCounted> callee = memnew(RefCounted);
+	callee->set_script(callee_script);
+	CHECK(int(caller->call("read", callee)) == 2);
+	CHECK(int(caller->call("call_get", callee)) == 20);
+}
+
+#ifdef DEBUG_ENABLED
+struct DisassemblyCounts {
+	int instructions = 0;
+	int saved_dispatches = 0;
+};
+
+static void count_disassembly(void *p_userdata, const String &p_string, bool p_error, bool p_rich) {
+	DisassemblyCounts *counts = (DisassemblyCounts *)p_userdata;
+	counts->instructions++;
+	if (p_string.contains("jump-if-not int ") || p_string.contains("jump-if-not float ")) {
+		counts->saved_dispatches += 1; // Comparison and conditional jump.
+	} else if (p_string.contains("validated member operator ")) {
+		counts->saved_dispatches += 2; // Get, operator and set.
+	}
+}
+
+// Counts the instructions of typical per frame code, and how many more there would be without superinstructions.
+TEST_CASE_BENCHMARK("[Modules][GDScript][Benchmark] Dispatch count of game loop scripts") {
+	static constexpr int ITERATIONS = 100000;
+
+	GDScriptLanguage::get_singleton()->init();
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends Node2D
+
+var velocity := Vector2(120.0, 0.0)
+var health := 100
+var cooldown := 0.0
+var hits := 0
+
+func _physics_process(delta: float) -> void:
+	velocity.y += 980.0 * delta
+	position += velocity * delta
+	rotation += 0.5 * delta
+	if position.y > 600.0:
+		position.y = 600.0
+		velocity.y = -velocity.y * 0.5
+	cooldown -= delta
+	if cooldown <= 0.0 and health > 0:
+		cooldown = 0.25
+		hits += 1
+		health -= 3
+
+func count_alive(values: Array[int]) -> int:
+	var alive := 0
+	var i := 0
+	while i < values.size():
+		if values[i] > 0:
+			alive += 1
+		i += 1
+	return alive
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE(error == OK);
+
+	DisassemblyCounts counts;
+	PrintHandlerList handler;
+	handler.printfunc = count_disassembly;
+	handler.userdata = &counts;
+	add_print_handler(&handler);
+	for (const KeyValue<StringName, GDScriptFunction *> &E : gdscript->get_member_functions()) {
+		E.value->disassemble(Vector<String>());
+	}
+	remove_print_handler(&handler);
+
+	Node2D *node = memnew(Node2D);
+	node->set_script(gdscript);
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < ITERATIONS; i++) {
+		node->call(SNAME("_physics_process"), 1.0 / 60.0);
+	}
+	const uint64_t usec = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(int(node->get("hits")) > 0);
+	memdelete(node);
+
+	MESSAGE(vformat("%d instructions, %d without superinstructions. %d ns per _physics_process() call.",
+			counts.instructions, counts.instructions + counts.saved_dispatches, usec * 1000 / ITERATIONS));
+}
+#endif // DEBUG_ENABLED
+
+TEST_CASE("[Modules][GDScript] Reload reuses the cached parse tree of unchanged binary tokens") {
+	GDScriptLanguage::get_singleton()->init();
+	const String path = TestUtils::get_temp_path("reload_parse_cache.gdc");
+	const Vector<uint8_t> tokens = GDScriptTokenizerBuffer::parse_code_string(R"(
+extends RefCounted
+
+func get_value():
+	return 1
+)",
+			GDScriptTokenizerBuffer::COMPRESS_NONE);
+	{
+		Ref<FileAccess> file = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(file.is_valid());
+		file->store_buffer(tokens);
+	}
+
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_path(path);
+	gdscript->set_binary_tokens_source(tokens);
+
+	// Same as the cache does when another script depends on this one.
+	Error error = OK;
+	Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(path, GDScriptParserRef::PARSED, error);
+	REQUIRE(error == OK);
+	REQUIRE(parser_ref.is_valid());
+
+	SUBCASE("Unchanged tokens compile the cached tree") {
+		CHECK(gdscript->reload() == OK);
+		CHECK(gdscript->is_valid());
+		CHECK_MESSAGE(parser_ref->get_status() == GDScriptParserRef::FULLY_SOLVED, "The cached parser should have been analyzed by reload().");
+		CHECK(GDScriptCache::has_parser(path));
+		Ref<GDScriptParserRef> parser_ref_after = GDScriptCache::get_parser(path, GDScriptParserRef::EMPTY, error);
+		CHECK(parser_ref_after == parser_ref);
+		CHECK(gdscript->has_method("get_value"));
+	}
+
+	SUBCASE("Modified tokens are parsed again") {
+		gdscript->set_binary_tokens_source(GDScriptTokenizerBuffer::parse_code_string(R"(
+extends RefCounted
+
+func get_other_value():
+	return 2
+)",
+				GDScriptTokenizerBuffer::COMPRESS_NONE));
+		CHECK(gdscript->reload() == OK);
+		CHECK(gdscript->is_valid());
+		CHECK_MESSAGE(parser_ref->get_status() == GDScriptParserRef::PARSED, "The stale parser should have been left alone.");
+		CHECK_FALSE(GDScriptCache::has_parser(path));
+		CHECK_FALSE(gdscript->has_method("get_value"));
+		CHECK(gdscript->has_method("get_other_value"));
+	}
+
+	parser_ref.unref();
+	gdscript.unref();
+	GDScriptCache::remove_script(path);
+	DirAccess::remove_absolute(path);
+}
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
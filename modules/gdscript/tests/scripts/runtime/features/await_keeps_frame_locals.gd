@@ -0,0 +1,20 @@
+# Locals must survive being moved into the function state on every await.
+
+signal resumed
+
+func counter(label: String) -> void:
+	var text := label
+	var numbers: Array[int] = [1, 2]
+	var total := 0.5
+	await resumed
+	numbers.push_back(3)
+	total += 1.0
+	await resumed
+	text += "!"
+	print(text, " ", numbers, " ", total)
+
+func test():
+	counter("first")
+	counter("second")
+	resumed.emit()
+	resumed.emit()
@@ -0,0 +1,43 @@
+# Typed comparisons followed by a conditional jump are fused into a single instruction.
+
+func count_below(limit: int) -> int:
+	var count := 0
+	var i := 0
+	while i < limit:
+		if i % 3 == 0 and i != 6:
+			count += 1
+		i += 1
+	return count
+
+func classify(value: float) -> String:
+	if value < 0.0:
+		return "negative"
+	elif value == 0.0:
+		return "zero"
+	elif value >= 100.0:
+		return "large"
+	return "positive"
+
+func test():
+	print(count_below(20))
+	print(count_below(0))
+
+	for value: float in [-1.5, 0.0, 3.25, 100.0, NAN]:
+		print(classify(value))
+
+	var a := 5
+	var b := 7
+	print("less" if a < b else "not less")
+	print("greater" if a > b else "not greater")
+
+	# Nested loops, the inner `if` at the end of the body jumps to the back-edge.
+	var total := 0
+	for x in 4:
+		var y := 0
+		while y <= x:
+			if y != 1:
+				total += y
+			else:
+				total -= 1
+			y += 1
+	print(total)
@@ -0,0 +1,23 @@
+extends Node2D
+
+# Compound assignments to typed native properties are fused into a single instruction.
+
+func test():
+	var velocity := Vector2(1.5, -2.0)
+	position = Vector2(10, 20)
+	for i in 4:
+		position += velocity
+	print(position)
+
+	rotation = 0.25
+	rotation *= 4.0
+	print(rotation)
+
+	z_index = 3
+	z_index -= 5
+	print(z_index)
+
+	# Untyped operands take the regular get, operator and set path.
+	var factor = 2
+	z_index *= factor
+	print(z_index)
@@ -0,0 +1,65 @@
+# Untyped property access and calls go through per call site caches keyed on the receiver.
+
+class A:
+	var value = 1
+	var typed_value: int = 0
+
+	func get_label():
+		return "A"
+
+class B extends A:
+	func get_label():
+		return "B"
+
+class C:
+	var value = "c"
+
+	func get_label():
+		return "C"
+
+class D:
+	var value = 4.5
+
+class E:
+	var value = [1]
+
+class F:
+	var value = Vector2(1, 2)
+
+func describe(obj):
+	return "%s=%s" % [obj.get_label(), obj.value]
+
+func grow(obj):
+	obj.value = obj.value + obj.value
+
+func read_value(obj):
+	return obj.value
+
+func test():
+	var objects = [A.new(), B.new(), C.new(), A.new()]
+	for i in 2:
+		var result = []
+		for obj in objects:
+			grow(obj)
+			result.append(describe(obj))
+		print(result)
+
+	# More receivers than the cache holds.
+	var values = []
+	for obj in [A.new(), B.new(), C.new(), D.new(), E.new(), F.new(), A.new()]:
+		values.append(read_value(obj))
+	print(values)
+
+	# Typed member that needs a conversion.
+	var a = [A.new()][0]
+	a.typed_value = 2.5
+	print(a.typed_value)
+
+	# Native properties and methods, including on script instances.
+	var node = Node.new()
+	for name in ["First", "Second"]:
+		node.name = name
+		print(node.name)
+	print(a.get_class())
+	print(node.get_class())
+	node.free()
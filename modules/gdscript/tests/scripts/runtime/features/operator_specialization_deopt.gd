@@ -0,0 +1,31 @@
+# Untyped operators in hot code get specialized at runtime, make sure
+# they still give the right result once operand types change.
+
+func add(a, b):
+	return a + b
+
+func less(a, b):
+	return a < b
+
+func test():
+	var sum = 0
+	for i in 2000:
+		sum = add(sum, i)
+	print(sum)
+
+	# Same sites, different types.
+	print(add(1.5, 2.25))
+	print(add(1, 2.5))
+	print(add("a", "b"))
+	print(add(Vector2(1, 2), Vector2(3, 4)))
+
+	var count = 0
+	for i in 2000:
+		if less(float(i), 1000.0):
+			count += 1
+	print(count)
+	print(less(1, 2))
+	print(less(3, 2.5))
+
+	# Integer overflow wraps like the generic operator.
+	print(add(9223372036854775807, 1))
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include "core/templates/safe_refcount.h"
+
 class GodotBody3D;
 class GodotSoftBody3D;
 
@@ -39,9 +41,12 @@ class GodotConstraint3D {
 	uint64_t island_step;
 	int priority;
 	bool disabled_collisions_between_bodies;
+	uint64_t creation_index;
 
 	RID self;
 
+	static inline SafeNumeric<uint64_t> creation_counter{ 0 };
+
 protected:
 	GodotConstraint3D(GodotBody3D **p_body_ptr = nullptr, int p_body_count = 0) {
 		_body_ptr = p_body_ptr;
@@ -49,12 +54,16 @@ protected:
 		island_step = 0;
 		priority = 1;
 		disabled_collisions_between_bodies = true;
+		creation_index = creation_counter.increment();
 	}
 
 public:
 	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
 	_FORCE_INLINE_ RID get_self() const { return self; }
 
+	// Constraints are created in a reproducible order, unlike the order they are found in when building islands.
+	_FORCE_INLINE_ uint64_t get_creation_index() const { return creation_index; }
+
 	_FORCE_INLINE_ uint64_t get_island_step() const { return island_step; }
 	_FORCE_INLINE_ void set_island_step(uint64_t p_step) { island_step = p_step; }
 
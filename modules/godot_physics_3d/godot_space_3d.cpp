@@ -34,6 +34,7 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "godot_area_pair_3d.h"
 #include "godot_body_pair_3d.h"
 
@@ -107,16 +108,19 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 	return cc;
 }
 
-bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V(space->locked, false);
-
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **r_cull_results, int *r_cull_subindex_results, LocalVector<uint32_t> *r_concurrent_cull_hits, RayResult &r_result) const {
 	Vector3 begin, end;
 	Vector3 normal;
-	begin = p_parameters.from;
-	end = p_parameters.to;
+	begin = p_from;
+	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount;
+	if (r_concurrent_cull_hits) {
+		amount = space->broadphase->cull_segment_concurrent(begin, end, r_cull_results, GodotSpace3D::INTERSECTION_QUERY_MAX, *r_concurrent_cull_hits, r_cull_subindex_results);
+	} else {
+		amount = space->broadphase->cull_segment(begin, end, r_cull_results, GodotSpace3D::INTERSECTION_QUERY_MAX, r_cull_subindex_results);
+	}
 
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
@@ -128,21 +132,21 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	real_t min_d = 1e10;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(r_cull_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(r_cull_results[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(r_cull_results[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = r_cull_results[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = r_cull_subindex_results[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -207,6 +211,55 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	return true;
 }
 
+bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V(space->locked, false);
+
+	return _intersect_ray(p_parameters, p_parameters.from, p_parameters.to, space->intersection_query_results, space->intersection_query_subindex_results, nullptr, r_result);
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_ray_batch_chunk(uint32_t p_chunk, RayBatch *p_batch) {
+	// Every chunk culls into its own buffers, as the ones of the space are shared.
+	LocalVector<GodotCollisionObject3D *> cull_results;
+	cull_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	LocalVector<int> cull_subindex_results;
+	cull_subindex_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	LocalVector<uint32_t> cull_hits;
+
+	const int begin = p_chunk * BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + BATCH_CHUNK_SIZE, p_batch->count);
+	for (int i = begin; i < end; i++) {
+		p_batch->hits[i] = _intersect_ray(*p_batch->parameters, p_batch->from[i], p_batch->to[i], cull_results.ptr(), cull_subindex_results.ptr(), &cull_hits, p_batch->results[i]);
+	}
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	for (int i = 0; i < p_count; i++) {
+		r_hits[i] = false;
+	}
+	ERR_FAIL_COND(space->locked);
+
+	if (p_count <= BATCH_CHUNK_SIZE) {
+		for (int i = 0; i < p_count; i++) {
+			r_hits[i] = _intersect_ray(p_parameters, p_from[i], p_to[i], space->intersection_query_results, space->intersection_query_subindex_results, nullptr, r_results[i]);
+		}
+		return;
+	}
+
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.count = p_count;
+	batch.results = r_results;
+	batch.hits = r_hits;
+
+	const int chunk_count = (p_count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+	// Chunks only lock the broadphase while culling, as holding it here while waiting could deadlock
+	// against worker threads that need it for something else.
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_ray_batch_chunk, &batch, chunk_count, -1, true, SNAME("Physics3DIntersectRayBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	if (p_result_max <= 0) {
 		return 0;
@@ -262,55 +315,59 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 	return cc;
 }
 
-bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
-	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
-	ERR_FAIL_NULL_V(shape, false);
+void GodotPhysicsDirectSpaceState3D::_cast_motion(const ShapeParameters &p_parameters, GodotShape3D *p_shape, const Transform3D &p_transform, const Vector3 &p_motion, GodotCollisionObject3D **r_cull_results, int *r_cull_subindex_results, LocalVector<uint32_t> *r_concurrent_cull_hits, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) const {
+	GodotShape3D *shape = p_shape;
 
-	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
-	aabb = aabb.merge(AABB(aabb.position + p_parameters.motion, aabb.size)); //motion
+	AABB aabb = p_transform.xform(shape->get_aabb());
+	aabb = aabb.merge(AABB(aabb.position + p_motion, aabb.size)); //motion
 	aabb = aabb.grow(p_parameters.margin);
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	int amount;
+	if (r_concurrent_cull_hits) {
+		amount = space->broadphase->cull_aabb_concurrent(aabb, r_cull_results, GodotSpace3D::INTERSECTION_QUERY_MAX, *r_concurrent_cull_hits, r_cull_subindex_results);
+	} else {
+		amount = space->broadphase->cull_aabb(aabb, r_cull_results, GodotSpace3D::INTERSECTION_QUERY_MAX, r_cull_subindex_results);
+	}
 
 	real_t best_safe = 1;
 	real_t best_unsafe = 1;
 
-	Transform3D xform_inv = p_parameters.transform.affine_inverse();
+	Transform3D xform_inv = p_transform.affine_inverse();
 	GodotMotionShape3D mshape;
 	mshape.shape = shape;
-	mshape.motion = xform_inv.basis.xform(p_parameters.motion);
+	mshape.motion = xform_inv.basis.xform(p_motion);
 
 	bool best_first = true;
 
-	Vector3 motion_normal = p_parameters.motion.normalized();
+	Vector3 motion_normal = p_motion.normalized();
 
 	Vector3 closest_A, closest_B;
 
 	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(r_cull_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(r_cull_results[i]->get_self())) {
 			continue; //ignore excluded
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = r_cull_results[i];
+		int shape_idx = r_cull_subindex_results[i];
 
 		Vector3 point_A, point_B;
 		Vector3 sep_axis = motion_normal;
 
 		Transform3D col_obj_xform = col_obj->get_transform() * col_obj->get_shape_transform(shape_idx);
 		//test initial overlap, does it collide if going all the way?
-		if (GodotCollisionSolver3D::solve_distance(&mshape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, aabb, &sep_axis)) {
+		if (GodotCollisionSolver3D::solve_distance(&mshape, p_transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, aabb, &sep_axis)) {
 			continue;
 		}
 
 		//test initial overlap, ignore objects it's inside of.
 		sep_axis = motion_normal;
 
-		if (!GodotCollisionSolver3D::solve_distance(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, aabb, &sep_axis)) {
+		if (!GodotCollisionSolver3D::solve_distance(shape, p_transform, col_obj->get_shape(shape_idx), col_obj_xform, point_A, point_B, aabb, &sep_axis)) {
 			continue;
 		}
 
@@ -321,11 +378,11 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 		for (int j = 0; j < 8; j++) { //steps should be customizable..
 			real_t fraction = low + (hi - low) * fraction_coeff;
 
-			mshape.motion = xform_inv.basis.xform(p_parameters.motion * fraction);
+			mshape.motion = xform_inv.basis.xform(p_motion * fraction);
 
 			Vector3 lA, lB;
 			Vector3 sep = motion_normal; //important optimization for this to work fast enough
-			bool collided = !GodotCollisionSolver3D::solve_distance(&mshape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj_xform, lA, lB, aabb, &sep);
+			bool collided = !GodotCollisionSolver3D::solve_distance(&mshape, p_transform, col_obj->get_shape(shape_idx), col_obj_xform, lA, lB, aabb, &sep);
 
 			if (collided) {
 				hi = fraction;
@@ -377,10 +434,67 @@ bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parame
 
 	p_closest_safe = best_safe;
 	p_closest_unsafe = best_unsafe;
+}
+
+bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL_V(shape, false);
 
+	_cast_motion(p_parameters, shape, p_parameters.transform, p_parameters.motion, space->intersection_query_results, space->intersection_query_subindex_results, nullptr, p_closest_safe, p_closest_unsafe, r_info);
 	return true;
 }
 
+void GodotPhysicsDirectSpaceState3D::_cast_motion_batch_chunk(uint32_t p_chunk, MotionBatch *p_batch) {
+	LocalVector<GodotCollisionObject3D *> cull_results;
+	cull_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	LocalVector<int> cull_subindex_results;
+	cull_subindex_results.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	LocalVector<uint32_t> cull_hits;
+
+	Transform3D transform = p_batch->parameters->transform;
+	const int begin = p_chunk * BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + BATCH_CHUNK_SIZE, p_batch->count);
+	for (int i = begin; i < end; i++) {
+		transform.origin = p_batch->origins[i];
+		_cast_motion(*p_batch->parameters, p_batch->shape, transform, p_batch->motions[i], cull_results.ptr(), cull_subindex_results.ptr(), &cull_hits, p_batch->closest_safe[i], p_batch->closest_unsafe[i], nullptr);
+	}
+}
+
+void GodotPhysicsDirectSpaceState3D::cast_motion_batch(const ShapeParameters &p_parameters, const Vector3 *p_origins, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	for (int i = 0; i < p_count; i++) {
+		r_closest_safe[i] = 1.0f;
+		r_closest_unsafe[i] = 1.0f;
+	}
+
+	ERR_FAIL_COND(space->locked);
+
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL(shape);
+
+	if (p_count <= BATCH_CHUNK_SIZE) {
+		Transform3D transform = p_parameters.transform;
+		for (int i = 0; i < p_count; i++) {
+			transform.origin = p_origins[i];
+			_cast_motion(p_parameters, shape, transform, p_motions[i], space->intersection_query_results, space->intersection_query_subindex_results, nullptr, r_closest_safe[i], r_closest_unsafe[i], nullptr);
+		}
+		return;
+	}
+
+	MotionBatch batch;
+	batch.parameters = &p_parameters;
+	batch.shape = shape;
+	batch.origins = p_origins;
+	batch.motions = p_motions;
+	batch.count = p_count;
+	batch.closest_safe = r_closest_safe;
+	batch.closest_unsafe = r_closest_unsafe;
+
+	const int chunk_count = (p_count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+	// See intersect_ray_batch() on locking.
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_cast_motion_batch_chunk, &batch, chunk_count, -1, true, SNAME("Physics3DCastMotionBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 bool GodotPhysicsDirectSpaceState3D::collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) {
 	if (p_result_max <= 0) {
 		return false;
@@ -1252,6 +1366,37 @@ bool GodotSpace3D::is_locked() const {
 	return locked;
 }
 
+uint64_t GodotSpace3D::get_state_hash() const {
+	struct BodyRIDComparator {
+		_FORCE_INLINE_ bool operator()(const GodotBody3D *p_a, const GodotBody3D *p_b) const {
+			return p_a->get_self().get_id() < p_b->get_self().get_id();
+		}
+	};
+
+	// RIDs are handed out in creation order, which gives a stable body order.
+	// Their values are left out of the hash, as RIDs of other servers may be interleaved.
+	LocalVector<const GodotBody3D *> bodies;
+	for (const GodotCollisionObject3D *object : objects) {
+		if (object->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			bodies.push_back(static_cast<const GodotBody3D *>(object));
+		}
+	}
+	bodies.sort_custom<BodyRIDComparator>();
+
+	uint64_t hash = HASH_MURMUR3_SEED;
+	for (const GodotBody3D *body : bodies) {
+		const Transform3D &transform = body->get_transform();
+		for (int i = 0; i < 3; i++) {
+			hash = hash64_murmur3_bits(transform.basis.rows[i], hash);
+		}
+		hash = hash64_murmur3_bits(transform.origin, hash);
+		hash = hash64_murmur3_bits(body->get_linear_velocity(), hash);
+		hash = hash64_murmur3_bits(body->get_angular_velocity(), hash);
+		hash = hash64_murmur3_64(body->is_active(), hash);
+	}
+	return hash;
+}
+
 GodotPhysicsDirectSpaceState3D *GodotSpace3D::get_direct_state() {
 	return direct_access;
 }
@@ -1265,6 +1410,7 @@ GodotSpace3D::GodotSpace3D() {
 	contact_max_separation = GLOBAL_GET("physics/3d/solver/contact_max_separation");
 	contact_max_allowed_penetration = GLOBAL_GET("physics/3d/solver/contact_max_allowed_penetration");
 	contact_bias = GLOBAL_GET("physics/3d/solver/default_contact_bias");
+	deterministic = GLOBAL_GET("physics/3d/solver/deterministic");
 
 	broadphase = GodotBroadPhase3D::create_func();
 	broadphase->set_pair_callback(_broadphase_pair, this);
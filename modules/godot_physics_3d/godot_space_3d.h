@@ -41,13 +41,44 @@
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	// Batched queries are split in chunks of this many queries, each one a group task element.
+	static constexpr int BATCH_CHUNK_SIZE = 64;
+
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		int count = 0;
+		RayResult *results = nullptr;
+		bool *hits = nullptr;
+	};
+
+	struct MotionBatch {
+		const ShapeParameters *parameters = nullptr;
+		GodotShape3D *shape = nullptr;
+		const Vector3 *origins = nullptr;
+		const Vector3 *motions = nullptr;
+		int count = 0;
+		real_t *closest_safe = nullptr;
+		real_t *closest_unsafe = nullptr;
+	};
+
+	// Queries cull into the given buffers. r_concurrent_cull_hits is only set by batched queries, whose chunks cull concurrently.
+	bool _intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **r_cull_results, int *r_cull_subindex_results, LocalVector<uint32_t> *r_concurrent_cull_hits, RayResult &r_result) const;
+	void _cast_motion(const ShapeParameters &p_parameters, GodotShape3D *p_shape, const Transform3D &p_transform, const Vector3 &p_motion, GodotCollisionObject3D **r_cull_results, int *r_cull_subindex_results, LocalVector<uint32_t> *r_concurrent_cull_hits, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) const;
+
+	void _intersect_ray_batch_chunk(uint32_t p_chunk, RayBatch *p_batch);
+	void _cast_motion_batch_chunk(uint32_t p_chunk, MotionBatch *p_batch);
+
 public:
 	GodotSpace3D *space = nullptr;
 
 	virtual int intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) override;
+	virtual void intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) override;
 	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info = nullptr) override;
+	virtual void cast_motion_batch(const ShapeParameters &p_parameters, const Vector3 *p_origins, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) override;
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) override;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const override;
@@ -107,6 +138,7 @@ private:
 	real_t body_time_to_sleep = 0.0;
 
 	bool locked = false;
+	bool deterministic = false;
 
 	real_t last_step = 0.001;
 
@@ -178,6 +210,9 @@ public:
 	void set_param(PhysicsServer3D::SpaceParameter p_param, real_t p_value);
 	real_t get_param(PhysicsServer3D::SpaceParameter p_param) const;
 
+	bool is_deterministic() const { return deterministic; }
+	uint64_t get_state_hash() const;
+
 	void set_island_count(int p_island_count) { island_count = p_island_count; }
 	int get_island_count() const { return island_count; }
 
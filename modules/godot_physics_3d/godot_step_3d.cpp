@@ -34,6 +34,7 @@
 
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
+#include "core/templates/sort_array.h"
 
 #define BODY_ISLAND_COUNT_RESERVE 128
 #define BODY_ISLAND_SIZE_RESERVE 512
@@ -112,6 +113,39 @@ void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, Local
 	}
 }
 
+struct ConstraintCreationComparator {
+	_FORCE_INLINE_ bool operator()(const GodotConstraint3D *p_a, const GodotConstraint3D *p_b) const {
+		return p_a->get_creation_index() < p_b->get_creation_index();
+	}
+};
+
+struct IslandCreationComparator {
+	const LocalVector<LocalVector<GodotConstraint3D *>> *constraint_islands = nullptr;
+
+	_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+		return (*constraint_islands)[p_a][0]->get_creation_index() < (*constraint_islands)[p_b][0]->get_creation_index();
+	}
+};
+
+void GodotStep3D::_sort_islands(uint32_t p_island_count) {
+	// Islands are built by walking hash maps and active lists, whose order depends on the
+	// history of the space. Sorting constraints by creation makes the solving order, and
+	// with it the accumulated impulses, only depend on the constraints themselves.
+	for (uint32_t island_index = 0; island_index < p_island_count; ++island_index) {
+		constraint_islands[island_index].sort_custom<ConstraintCreationComparator>();
+	}
+
+	// Islands are solved on separate threads but pre-solved in sequence, which can report
+	// contacts to bodies shared between islands (e.g. static ones), so sort them too.
+	island_order.resize(p_island_count);
+	for (uint32_t island_index = 0; island_index < p_island_count; ++island_index) {
+		island_order[island_index] = island_index;
+	}
+	SortArray<uint32_t, IslandCreationComparator> sorter;
+	sorter.compare.constraint_islands = &constraint_islands;
+	sorter.sort(island_order.ptr(), p_island_count);
+}
+
 void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
 	GodotConstraint3D *constraint = all_constraints[p_constraint_index];
 	constraint->setup(delta);
@@ -335,6 +369,11 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	p_space->set_island_count((int)island_count);
 
+	const bool deterministic = p_space->is_deterministic();
+	if (deterministic) {
+		_sort_islands(island_count);
+	}
+
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
 		p_space->set_elapsed_time(GodotSpace3D::ELAPSED_TIME_GENERATE_ISLANDS, profile_endtime - profile_begtime);
@@ -357,7 +396,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	// WARNING: This doesn't run on threads, because it involves thread-unsafe processing.
 	for (uint32_t island_index = 0; island_index < island_count; ++island_index) {
-		_pre_solve_island(constraint_islands[island_index]);
+		_pre_solve_island(constraint_islands[deterministic ? island_order[island_index] : island_index]);
 	}
 
 	/* SOLVE CONSTRAINT ISLANDS */
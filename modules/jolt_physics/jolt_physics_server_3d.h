@@ -155,6 +155,7 @@ public:
 
 	virtual void space_set_param(RID p_space, PhysicsServer3D::SpaceParameter p_param, real_t p_value) override;
 	virtual real_t space_get_param(RID p_space, PhysicsServer3D::SpaceParameter p_param) const override;
+	virtual uint64_t space_get_state_hash(RID p_space) const override;
 
 	virtual PhysicsDirectSpaceState3D *space_get_direct_state(RID p_space) override;
 
@@ -44,6 +44,8 @@
 #include "jolt_query_filter_3d.h"
 #include "jolt_space_3d.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include "Jolt/Geometry/GJKClosestPoint.h"
 #include "Jolt/Physics/Body/Body.h"
 #include "Jolt/Physics/Body/BodyFilter.h"
@@ -461,15 +463,9 @@ JoltPhysicsDirectSpaceState3D::JoltPhysicsDirectSpaceState3D(JoltSpace3D *p_spac
 		space(p_space) {
 }
 
-bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_ray must not be called while the physics space is being stepped.");
-
-	space->flush_pending_objects();
-
-	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
-
-	const JPH::RVec3 from = to_jolt_r(p_parameters.from);
-	const JPH::RVec3 to = to_jolt_r(p_parameters.to);
+bool JoltPhysicsDirectSpaceState3D::_intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, const JoltQueryFilter3D &p_query_filter, RayResult &r_result) {
+	const JPH::RVec3 from = to_jolt_r(p_from);
+	const JPH::RVec3 to = to_jolt_r(p_to);
 	const JPH::Vec3 vector = JPH::Vec3(to - from);
 	const JPH::RRayCast ray(from, vector);
 
@@ -480,7 +476,7 @@ bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_paramet
 	settings.mBackFaceModeTriangles = back_face_mode;
 
 	JoltQueryCollectorClosest<JPH::CastRayCollector> collector;
-	space->get_narrow_phase_query().CastRay(ray, settings, collector, query_filter, query_filter, query_filter);
+	space->get_narrow_phase_query().CastRay(ray, settings, collector, p_query_filter, p_query_filter, p_query_filter);
 
 	if (!collector.had_hit()) {
 		return false;
@@ -524,6 +520,56 @@ bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_paramet
 	return true;
 }
 
+bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_ray must not be called while the physics space is being stepped.");
+
+	space->flush_pending_objects();
+
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
+	return _intersect_ray(p_parameters, p_parameters.from, p_parameters.to, query_filter, r_result);
+}
+
+void JoltPhysicsDirectSpaceState3D::_intersect_ray_batch_chunk(uint32_t p_chunk, RayBatch *p_batch) {
+	const int begin = p_chunk * BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + BATCH_CHUNK_SIZE, p_batch->count);
+	for (int i = begin; i < end; i++) {
+		p_batch->hits[i] = _intersect_ray(*p_batch->parameters, p_batch->from[i], p_batch->to[i], *p_batch->query_filter, p_batch->results[i]);
+	}
+}
+
+void JoltPhysicsDirectSpaceState3D::intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	for (int i = 0; i < p_count; i++) {
+		r_hits[i] = false;
+	}
+
+	ERR_FAIL_COND_MSG(space->is_stepping(), "intersect_ray_batch must not be called while the physics space is being stepped.");
+
+	space->flush_pending_objects();
+
+	// Jolt's queries are safe to run concurrently, so the whole batch shares one filter.
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
+
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.query_filter = &query_filter;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.count = p_count;
+	batch.results = r_results;
+	batch.hits = r_hits;
+
+	const int chunk_count = (p_count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+	if (chunk_count <= 1) {
+		for (int i = 0; i < chunk_count; i++) {
+			_intersect_ray_batch_chunk(i, &batch);
+		}
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &JoltPhysicsDirectSpaceState3D::_intersect_ray_batch_chunk, &batch, chunk_count, -1, true, SNAME("JoltIntersectRayBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 int JoltPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_point must not be called while the physics space is being stepped.");
 
@@ -650,6 +696,70 @@ bool JoltPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_paramet
 	return true;
 }
 
+void JoltPhysicsDirectSpaceState3D::_cast_motion_batch_chunk(uint32_t p_chunk, MotionBatch *p_batch) {
+	Transform3D transform = p_batch->transform;
+	const int begin = p_chunk * BATCH_CHUNK_SIZE;
+	const int end = MIN(begin + BATCH_CHUNK_SIZE, p_batch->count);
+	for (int i = begin; i < end; i++) {
+		transform.origin = p_batch->origins[i];
+		const Transform3D transform_com = transform.translated_local(p_batch->com_scaled);
+		_cast_motion_impl(*p_batch->jolt_shape, transform_com, p_batch->scale, p_batch->motions[i], JoltProjectSettings::use_enhanced_internal_edge_removal_for_queries, true, *p_batch->settings, *p_batch->query_filter, *p_batch->query_filter, *p_batch->query_filter, JPH::ShapeFilter(), p_batch->closest_safe[i], p_batch->closest_unsafe[i]);
+	}
+}
+
+void JoltPhysicsDirectSpaceState3D::cast_motion_batch(const ShapeParameters &p_parameters, const Vector3 *p_origins, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) {
+	for (int i = 0; i < p_count; i++) {
+		r_closest_safe[i] = 1.0f;
+		r_closest_unsafe[i] = 1.0f;
+	}
+
+	ERR_FAIL_COND_MSG(space->is_stepping(), "cast_motion_batch must not be called while the physics space is being stepped.");
+
+	space->flush_pending_objects();
+
+	JoltShape3D *shape = JoltPhysicsServer3D::get_singleton()->get_shape(p_parameters.shape_rid);
+	ERR_FAIL_NULL(shape);
+
+	const JPH::ShapeRefC jolt_shape = shape->try_build();
+	ERR_FAIL_NULL(jolt_shape);
+
+	Transform3D transform = p_parameters.transform;
+	JOLT_ENSURE_SCALE_NOT_ZERO(transform, "cast_motion_batch was passed an invalid transform.");
+
+	Vector3 scale;
+	JoltMath::decompose(transform, scale);
+	JOLT_ENSURE_SCALE_VALID(jolt_shape, scale, "cast_motion_batch was passed an invalid transform.");
+
+	JPH::CollideShapeSettings settings;
+	settings.mMaxSeparationDistance = (float)p_parameters.margin;
+
+	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude);
+
+	MotionBatch batch;
+	batch.jolt_shape = jolt_shape.GetPtr();
+	batch.transform = transform;
+	batch.scale = scale;
+	batch.com_scaled = to_godot(jolt_shape->GetCenterOfMass());
+	batch.settings = &settings;
+	batch.query_filter = &query_filter;
+	batch.origins = p_origins;
+	batch.motions = p_motions;
+	batch.count = p_count;
+	batch.closest_safe = r_closest_safe;
+	batch.closest_unsafe = r_closest_unsafe;
+
+	const int chunk_count = (p_count + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+	if (chunk_count <= 1) {
+		for (int i = 0; i < chunk_count; i++) {
+			_cast_motion_batch_chunk(i, &batch);
+		}
+		return;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &JoltPhysicsDirectSpaceState3D::_cast_motion_batch_chunk, &batch, chunk_count, -1, true, SNAME("JoltCastMotionBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 bool JoltPhysicsDirectSpaceState3D::collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) {
 	r_result_count = 0;
 
@@ -43,6 +43,7 @@
 #include "Jolt/Physics/Collision/ShapeFilter.h"
 
 class JoltBody3D;
+class JoltQueryFilter3D;
 class JoltShape3D;
 class JoltSpace3D;
 
@@ -51,8 +52,39 @@ class JoltPhysicsDirectSpaceState3D final : public PhysicsDirectSpaceState3D {
 
 	JoltSpace3D *space = nullptr;
 
+	// Batched queries are split in chunks of this many queries, each one a group task element.
+	static constexpr int BATCH_CHUNK_SIZE = 64;
+
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const JoltQueryFilter3D *query_filter = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		int count = 0;
+		RayResult *results = nullptr;
+		bool *hits = nullptr;
+	};
+
+	struct MotionBatch {
+		const JPH::Shape *jolt_shape = nullptr;
+		Transform3D transform;
+		Vector3 scale;
+		Vector3 com_scaled;
+		const JPH::CollideShapeSettings *settings = nullptr;
+		const JoltQueryFilter3D *query_filter = nullptr;
+		const Vector3 *origins = nullptr;
+		const Vector3 *motions = nullptr;
+		int count = 0;
+		real_t *closest_safe = nullptr;
+		real_t *closest_unsafe = nullptr;
+	};
+
 	static void _bind_methods() {}
 
+	bool _intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, const JoltQueryFilter3D &p_query_filter, RayResult &r_result);
+	void _intersect_ray_batch_chunk(uint32_t p_chunk, RayBatch *p_batch);
+	void _cast_motion_batch_chunk(uint32_t p_chunk, MotionBatch *p_batch);
+
 	bool _cast_motion_impl(const JPH::Shape &p_jolt_shape, const Transform3D &p_transform_com, const Vector3 &p_scale, const Vector3 &p_motion, bool p_use_edge_removal, bool p_ignore_overlaps, const JPH::CollideShapeSettings &p_settings, const JPH::BroadPhaseLayerFilter &p_broad_phase_layer_filter, const JPH::ObjectLayerFilter &p_object_layer_filter, const JPH::BodyFilter &p_body_filter, const JPH::ShapeFilter &p_shape_filter, real_t &r_closest_safe, real_t &r_closest_unsafe) const;
 
 	bool _body_motion_recover(const JoltBody3D &p_body, const Transform3D &p_transform, float p_margin, const HashSet<RID> &p_excluded_bodies, const HashSet<ObjectID> &p_excluded_objects, Vector3 &r_recovery) const;
@@ -71,9 +103,11 @@ public:
 	explicit JoltPhysicsDirectSpaceState3D(JoltSpace3D *p_space);
 
 	virtual bool intersect_ray(const RayParameters &p_parameters, RayResult &r_result) override;
+	virtual void intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) override;
 	virtual int intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual int intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) override;
 	virtual bool cast_motion(const ShapeParameters &p_parameters, real_t &r_closest_safe, real_t &r_closest_unsafe, ShapeRestInfo *r_info = nullptr) override;
+	virtual void cast_motion_batch(const ShapeParameters &p_parameters, const Vector3 *p_origins, const Vector3 *p_motions, int p_count, real_t *r_closest_safe, real_t *r_closest_unsafe) override;
 	virtual bool collide_shape(const ShapeParameters &p_parameters, Vector3 *r_results, int p_result_max, int &r_result_count) override;
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, Vector3 p_point) const override;
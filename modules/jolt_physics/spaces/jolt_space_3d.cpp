@@ -34,6 +34,7 @@
 #include "../jolt_physics_server_3d.h"
 #include "../jolt_project_settings.h"
 #include "../misc/jolt_stream_wrappers.h"
+#include "../misc/jolt_type_conversions.h"
 #include "../objects/jolt_area_3d.h"
 #include "../objects/jolt_body_3d.h"
 #include "../shapes/jolt_custom_shape_type.h"
@@ -321,6 +322,30 @@ void JoltSpace3D::map_from_object_layer(JPH::ObjectLayer p_object_layer, JPH::Br
 	layers->from_object_layer(p_object_layer, r_broad_phase_layer, r_collision_layer, r_collision_mask);
 }
 
+uint64_t JoltSpace3D::get_state_hash() const {
+	// Bodies are listed by index, which is handed out and reused in a reproducible order.
+	JPH::BodyIDVector body_ids;
+	physics_system->GetBodies(body_ids);
+
+	uint64_t hash = HASH_MURMUR3_SEED;
+	for (const JPH::BodyID &body_id : body_ids) {
+		const JPH::Body *jolt_body = try_get_jolt_body(body_id);
+		if (jolt_body == nullptr) {
+			continue;
+		}
+
+		const Basis basis = to_godot(jolt_body->GetRotation());
+		for (int i = 0; i < 3; i++) {
+			hash = hash64_murmur3_bits(basis.rows[i], hash);
+		}
+		hash = hash64_murmur3_bits(to_godot(jolt_body->GetPosition()), hash);
+		hash = hash64_murmur3_bits(to_godot(jolt_body->GetLinearVelocity()), hash);
+		hash = hash64_murmur3_bits(to_godot(jolt_body->GetAngularVelocity()), hash);
+		hash = hash64_murmur3_64(jolt_body->IsActive(), hash);
+	}
+	return hash;
+}
+
 JPH::Body *JoltSpace3D::try_get_jolt_body(const JPH::BodyID &p_body_id) const {
 	return get_lock_iface().TryGetBody(p_body_id);
 }
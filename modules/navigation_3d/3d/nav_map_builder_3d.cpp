@@ -70,6 +70,8 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	_build_step_cluster_graph(r_build);
+
 	_build_update_map_iteration(r_build);
 }
 
@@ -387,6 +389,145 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder3D::_build_step_cluster_graph(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	LocalVector<uint32_t> &polygon_clusters = r_build.iter_polygon_clusters;
+	LocalVector<Cluster> &clusters = map_iteration->clusters;
+	LocalVector<ClusterConnection> &cluster_connections = map_iteration->cluster_connections;
+
+	polygon_clusters.clear();
+	clusters.clear();
+	cluster_connections.clear();
+	map_iteration->cluster_min_travel_cost = 1.0;
+
+	if (r_build.cluster_size <= 0.0) {
+		return;
+	}
+
+	const HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
+
+	// Polygons are numbered like the path query polygon ids, regions first and links last.
+	HashMap<const NavBaseIteration3D *, uint32_t> navbase_polygon_offsets;
+	LocalVector<const Polygon *> polygons;
+	polygons.reserve(r_build.polygon_count);
+
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		navbase_polygon_offsets[region.ptr()] = polygons.size();
+		for (const Polygon &polygon : region->navmesh_polygons) {
+			polygons.push_back(&polygon);
+		}
+	}
+	for (const Polygon &polygon : map_iteration->navlink_polygons) {
+		navbase_polygon_offsets[polygon.owner] = polygons.size();
+		polygons.push_back(&polygon);
+	}
+
+	// Group the polygons by the grid cell of their center.
+	const Vector3 cluster_cell_size = Vector3(r_build.cluster_size, r_build.cluster_size, r_build.cluster_size);
+	HashMap<uint64_t, uint32_t> cell_to_cluster;
+	LocalVector<uint32_t> cluster_polygon_counts;
+	real_t min_travel_cost = FLT_MAX;
+
+	polygon_clusters.resize(polygons.size());
+	for (uint32_t polygon_id = 0; polygon_id < polygons.size(); polygon_id++) {
+		const Polygon &polygon = *polygons[polygon_id];
+		if (polygon.vertices.is_empty()) {
+			// Unconnected navigation link.
+			polygon_clusters[polygon_id] = UINT32_MAX;
+			continue;
+		}
+
+		Vector3 center;
+		for (const Vector3 &vertex : polygon.vertices) {
+			center += vertex;
+		}
+		center /= polygon.vertices.size();
+
+		const uint64_t cell_key = get_point_key(center, cluster_cell_size).key;
+		HashMap<uint64_t, uint32_t>::Iterator cluster_it = cell_to_cluster.find(cell_key);
+		if (!cluster_it) {
+			cluster_it = cell_to_cluster.insert(cell_key, clusters.size());
+			clusters.push_back(Cluster());
+			cluster_polygon_counts.push_back(0);
+		}
+
+		const uint32_t cluster_id = cluster_it->value;
+		Cluster &cluster = clusters[cluster_id];
+		cluster.center += center;
+		cluster.travel_cost = MIN(cluster.travel_cost, polygon.owner->get_travel_cost());
+		cluster_polygon_counts[cluster_id] += 1;
+		polygon_clusters[polygon_id] = cluster_id;
+
+		min_travel_cost = MIN(min_travel_cost, polygon.owner->get_travel_cost());
+	}
+
+	if (clusters.is_empty()) {
+		return;
+	}
+
+	for (uint32_t cluster_id = 0; cluster_id < clusters.size(); cluster_id++) {
+		clusters[cluster_id].center /= cluster_polygon_counts[cluster_id];
+	}
+	map_iteration->cluster_min_travel_cost = min_travel_cost;
+
+	// Collect every pair of clusters that has at least one polygon connection between them.
+	LocalVector<uint64_t> cluster_pairs;
+	for (uint32_t polygon_id = 0; polygon_id < polygons.size(); polygon_id++) {
+		const uint32_t cluster_id = polygon_clusters[polygon_id];
+		if (cluster_id == UINT32_MAX) {
+			continue;
+		}
+
+		const Polygon &polygon = *polygons[polygon_id];
+
+		const LocalVector<LocalVector<Connection>> &internal_connections = polygon.owner->get_internal_connections();
+		if (polygon.id < internal_connections.size()) {
+			for (const Connection &connection : internal_connections[polygon.id]) {
+				const uint32_t other_cluster_id = polygon_clusters[navbase_polygon_offsets[connection.polygon->owner] + connection.polygon->id];
+				if (other_cluster_id != cluster_id && other_cluster_id != UINT32_MAX) {
+					cluster_pairs.push_back((uint64_t(cluster_id) << 32) | other_cluster_id);
+				}
+			}
+		}
+
+		HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>>::ConstIterator external_it = navbases_polygons_external_connections.find(polygon.owner);
+		if (external_it && polygon.id < external_it->value.size()) {
+			for (const Connection &connection : external_it->value[polygon.id]) {
+				const uint32_t other_cluster_id = polygon_clusters[navbase_polygon_offsets[connection.polygon->owner] + connection.polygon->id];
+				if (other_cluster_id != cluster_id && other_cluster_id != UINT32_MAX) {
+					cluster_pairs.push_back((uint64_t(cluster_id) << 32) | other_cluster_id);
+				}
+			}
+		}
+	}
+
+	// Sorted pairs group the connections per source cluster.
+	cluster_pairs.sort();
+
+	cluster_connections.reserve(cluster_pairs.size());
+	for (uint32_t i = 0; i < cluster_pairs.size(); i++) {
+		if (i > 0 && cluster_pairs[i] == cluster_pairs[i - 1]) {
+			continue;
+		}
+
+		const uint32_t from_cluster_id = cluster_pairs[i] >> 32;
+		const uint32_t to_cluster_id = cluster_pairs[i] & UINT32_MAX;
+		const Cluster &from_cluster = clusters[from_cluster_id];
+		const Cluster &to_cluster = clusters[to_cluster_id];
+
+		ClusterConnection connection;
+		connection.cluster = to_cluster_id;
+		connection.cost = from_cluster.center.distance_to(to_cluster.center) * (from_cluster.travel_cost + to_cluster.travel_cost) * 0.5;
+
+		if (cluster_connections.is_empty() || (cluster_pairs[i] >> 32) != (cluster_pairs[i - 1] >> 32)) {
+			clusters[from_cluster_id].connections_begin = cluster_connections.size();
+		}
+		cluster_connections.push_back(connection);
+		clusters[from_cluster_id].connections_end = cluster_connections.size();
+	}
+}
+
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
@@ -402,6 +543,18 @@ void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_buil
 		p_path_query_slot.path_corridor.clear();
 
 		p_path_query_slot.path_corridor.resize(total_polygon_count);
+		p_path_query_slot.path_corridor_touched_ids.clear();
+
+		const LocalVector<uint32_t> &polygon_clusters = r_build.iter_polygon_clusters;
+		for (uint32_t polygon_id = 0; polygon_id < total_polygon_count; polygon_id++) {
+			NavigationPoly &navigation_poly = p_path_query_slot.path_corridor[polygon_id];
+			navigation_poly.reset();
+			navigation_poly.cluster_id = polygon_id < polygon_clusters.size() ? polygon_clusters[polygon_id] : UINT32_MAX;
+		}
+
+		p_path_query_slot.traversable_clusters.clear();
+		p_path_query_slot.cluster_corridor.clear();
+		p_path_query_slot.cluster_corridor.resize(map_iteration->clusters.size());
 
 		p_path_query_slot.poly_to_id.clear();
 		p_path_query_slot.poly_to_id.reserve(total_polygon_count);
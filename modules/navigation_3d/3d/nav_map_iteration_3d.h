@@ -44,6 +44,7 @@ struct NavMapIteration3D;
 
 struct NavMapIterationBuild3D {
 	Vector3 merge_rasterizer_cell_size;
+	real_t cluster_size = 0.0;
 	bool use_edge_connections = true;
 	real_t edge_connection_margin;
 	real_t link_connection_radius;
@@ -53,6 +54,7 @@ struct NavMapIterationBuild3D {
 
 	HashMap<Nav3D::EdgeKey, Nav3D::EdgeConnectionPair, Nav3D::EdgeKey> iter_connection_pairs_map;
 	LocalVector<Nav3D::Connection> iter_free_edges;
+	LocalVector<uint32_t> iter_polygon_clusters;
 
 	NavMapIteration3D *map_iteration = nullptr;
 
@@ -63,6 +65,7 @@ struct NavMapIterationBuild3D {
 
 		iter_connection_pairs_map.clear();
 		iter_free_edges.clear();
+		iter_polygon_clusters.clear();
 		polygon_count = 0;
 		free_edge_count = 0;
 
@@ -87,6 +90,11 @@ struct NavMapIteration3D {
 
 	LocalVector<Nav3D::Polygon> navlink_polygons;
 
+	// Coarse graph of polygon clusters used by hierarchical path queries.
+	LocalVector<Nav3D::Cluster> clusters;
+	LocalVector<Nav3D::ClusterConnection> cluster_connections;
+	real_t cluster_min_travel_cost = 1.0;
+
 	HashMap<NavRegion3D *, Ref<NavRegionIteration3D>> region_ptr_to_region_iteration;
 
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
@@ -102,6 +110,9 @@ struct NavMapIteration3D {
 		external_region_connections.clear();
 		navbases_polygons_external_connections.clear();
 		navlink_polygons.clear();
+		clusters.clear();
+		cluster_connections.clear();
+		cluster_min_travel_cost = 1.0;
 		region_ptr_to_region_iteration.clear();
 	}
 };
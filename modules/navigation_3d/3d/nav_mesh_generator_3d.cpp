@@ -47,6 +47,9 @@ bool NavMeshGenerator3D::baking_use_multiple_threads = true;
 bool NavMeshGenerator3D::baking_use_high_priority_threads = true;
 HashMap<Ref<NavigationMesh>, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::baking_navmeshes;
 HashMap<WorkerThreadPool::TaskID, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::generator_tasks;
+Mutex NavMeshGenerator3D::tile_cache_mutex;
+HashMap<ObjectID, NavMeshGenerator3D::NavMeshTileCache3D *> NavMeshGenerator3D::tile_caches;
+SafeNumeric<uint32_t> NavMeshGenerator3D::baked_tile_count;
 LocalVector<NavMeshGeometryParser3D *> NavMeshGenerator3D::generator_parsers;
 
 static const char *_navmesh_bake_state_msgs[(size_t)NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_MAX] = {
@@ -63,6 +66,7 @@ static const char *_navmesh_bake_state_msgs[(size_t)NavMeshGenerator3D::NavMeshB
 	"Converting to native navigation mesh...", // step 10
 	"Baking cleanup...",
 	"Baking finished.",
+	"Baking tiles...",
 };
 
 NavMeshGenerator3D *NavMeshGenerator3D::get_singleton() {
@@ -86,6 +90,9 @@ NavMeshGenerator3D::~NavMeshGenerator3D() {
 }
 
 void NavMeshGenerator3D::sync() {
+	// Navigation meshes don't notify the generator when freed, drop their tiles on the next sync instead.
+	generator_evict_freed_tile_caches();
+
 	if (generator_tasks.is_empty()) {
 		return;
 	}
@@ -136,6 +143,12 @@ void NavMeshGenerator3D::cleanup() {
 		generator_parsers_rwlock.write_lock();
 		generator_parsers.clear();
 		generator_parsers_rwlock.write_unlock();
+
+		MutexLock tile_cache_lock(tile_cache_mutex);
+		for (KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+			memdelete(E.value);
+		}
+		tile_caches.clear();
 	}
 }
 
@@ -247,6 +260,10 @@ String NavMeshGenerator3D::get_baking_state_msg(Ref<NavigationMesh> p_navigation
 	return bake_state_msg;
 }
 
+uint32_t NavMeshGenerator3D::get_baked_tile_count() {
+	return baked_tile_count.get();
+}
+
 void NavMeshGenerator3D::generator_thread_bake(void *p_arg) {
 	NavMeshGeneratorTask3D *generator_task = static_cast<NavMeshGeneratorTask3D *>(p_arg);
 
@@ -322,13 +339,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		return;
 	}
 
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
-
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONFIGURATION; // step #1
 
 	const float *verts = source_geometry_vertices.ptr();
@@ -405,6 +415,21 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
 	}
 
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		generator_bake_tiles(p_generator_task, cfg, verts, nverts, tris, ntris, projected_obstructions);
+		return;
+	}
+
+	// Drop the tiles of earlier tiled bakes, they won't be reused.
+	{
+		MutexLock tile_cache_lock(tile_cache_mutex);
+		NavMeshTileCache3D **tile_cache = tile_caches.getptr(p_navigation_mesh->get_instance_id());
+		if (tile_cache) {
+			memdelete(*tile_cache);
+			tile_caches.erase(p_navigation_mesh->get_instance_id());
+		}
+	}
+
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CALC_GRID_SIZE; // step #2
 	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
 
@@ -419,23 +444,88 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		return;
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
+	LocalVector<Vector3> baked_vertices;
+	LocalVector<int> baked_indices;
+	if (!generator_bake_recast(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, &p_generator_task->bake_state, baked_vertices, baked_indices)) {
+		return;
+	}
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+
+	nav_vertices.resize(baked_vertices.size());
+	Vector3 *nav_vertices_ptrw = nav_vertices.ptrw();
+	for (uint32_t i = 0; i < baked_vertices.size(); i++) {
+		nav_vertices_ptrw[i] = baked_vertices[i];
+	}
+
+	nav_polygons.resize(baked_indices.size() / 3);
+	Vector<int> *nav_polygons_ptrw = nav_polygons.ptrw();
+	for (int i = 0; i < nav_polygons.size(); i++) {
+		Vector<int> &nav_indices = nav_polygons_ptrw[i];
+		nav_indices.resize(3);
+		nav_indices.write[0] = baked_indices[i * 3 + 0];
+		nav_indices.write[1] = baked_indices[i * 3 + 1];
+		nav_indices.write[2] = baked_indices[i * 3 + 2];
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
+}
+
+bool NavMeshGenerator3D::generator_bake_recast(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_config, const float *p_vertices, int p_vertex_count, const int *p_indices, int p_triangle_count, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, NavMeshBakeState *r_bake_state, LocalVector<Vector3> &r_vertices, LocalVector<int> &r_indices) {
+	const rcConfig &cfg = p_config;
+	const float *verts = p_vertices;
+	const int nverts = p_vertex_count;
+	const int *tris = p_indices;
+	const int ntris = p_triangle_count;
+
+	// Tiles are baked concurrently and don't report their progress.
+	NavMeshBakeState unused_bake_state;
+	NavMeshBakeState &bake_state = r_bake_state ? *r_bake_state : unused_bake_state;
+
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	rcContext ctx;
+
+	// Frees whatever is still allocated when a step fails and returns early.
+	struct RecastCleanup {
+		rcHeightfield *&hf;
+		rcCompactHeightfield *&chf;
+		rcContourSet *&cset;
+		rcPolyMesh *&poly_mesh;
+		rcPolyMeshDetail *&detail_mesh;
+
+		~RecastCleanup() {
+			rcFreeHeightField(hf);
+			rcFreeCompactHeightfield(chf);
+			rcFreeContourSet(cset);
+			rcFreePolyMesh(poly_mesh);
+			rcFreePolyMeshDetail(detail_mesh);
+		}
+	} recast_cleanup{ hf, chf, cset, poly_mesh, detail_mesh };
+
+	bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch), false);
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
+	bake_state = NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
 	{
 		Vector<unsigned char> tri_areas;
 		tri_areas.resize(ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
 		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
 		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
@@ -448,19 +538,19 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
+	bake_state = NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -475,13 +565,13 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		}
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
+	bake_state = NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -496,48 +586,48 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		}
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
+	bake_state = NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea), false);
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
+	bake_state = NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset), false);
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
+	bake_state = NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
 	rcFreeContourSet(cset);
 	cset = nullptr;
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
-
-	Vector<Vector3> nav_vertices;
-	Vector<Vector<int>> nav_polygons;
+	bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
 
 	HashMap<Vector3, int> recast_vertex_to_native_index;
 	LocalVector<int> recast_index_to_native_index;
 	recast_index_to_native_index.resize(detail_mesh->nverts);
 
+	r_vertices.clear();
+	r_indices.clear();
+
 	for (int i = 0; i < detail_mesh->nverts; i++) {
 		const float *v = &detail_mesh->verts[i * 3];
 		const Vector3 vertex = Vector3(v[0], v[1], v[2]);
@@ -546,7 +636,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 			int new_index = recast_vertex_to_native_index.size();
 			recast_index_to_native_index[i] = new_index;
 			recast_vertex_to_native_index[vertex] = new_index;
-			nav_vertices.push_back(vertex);
+			r_vertices.push_back(vertex);
 		} else {
 			recast_index_to_native_index[i] = *existing_index_ptr;
 		}
@@ -559,33 +649,483 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		const unsigned int detail_mesh_ntris = detail_mesh_m[3];
 		const unsigned char *detail_mesh_tris = &detail_mesh->tris[detail_mesh_m_btris * 4];
 		for (unsigned int j = 0; j < detail_mesh_ntris; j++) {
-			Vector<int> nav_indices;
-			nav_indices.resize(3);
 			// Polygon order in recast is opposite than godot's
 			int index1 = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 0]));
 			int index2 = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 2]));
 			int index3 = ((int)(detail_mesh_bverts + detail_mesh_tris[j * 4 + 1]));
 
-			nav_indices.write[0] = recast_index_to_native_index[index1];
-			nav_indices.write[1] = recast_index_to_native_index[index2];
-			nav_indices.write[2] = recast_index_to_native_index[index3];
-
-			nav_polygons.push_back(nav_indices);
+			r_indices.push_back(recast_index_to_native_index[index1]);
+			r_indices.push_back(recast_index_to_native_index[index2]);
+			r_indices.push_back(recast_index_to_native_index[index3]);
 		}
 	}
 
-	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
-
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
+	bake_state = NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
 
 	rcFreePolyMesh(poly_mesh);
 	poly_mesh = nullptr;
 	rcFreePolyMeshDetail(detail_mesh);
 	detail_mesh = nullptr;
 
+	return true;
+}
+
+void NavMeshGenerator3D::generator_evict_freed_tile_caches() {
+	MutexLock tile_cache_lock(tile_cache_mutex);
+
+	if (tile_caches.is_empty()) {
+		return;
+	}
+
+	LocalVector<ObjectID> freed_navigation_meshes;
+	for (const KeyValue<ObjectID, NavMeshTileCache3D *> &E : tile_caches) {
+		if (ObjectDB::get_instance(E.key) == nullptr) {
+			freed_navigation_meshes.push_back(E.key);
+		}
+	}
+	for (const ObjectID &navigation_mesh_id : freed_navigation_meshes) {
+		memdelete(tile_caches[navigation_mesh_id]);
+		tile_caches.erase(navigation_mesh_id);
+	}
+}
+
+NavMeshGenerator3D::NavMeshTileCache3D *NavMeshGenerator3D::generator_get_tile_cache(const Ref<NavigationMesh> &p_navigation_mesh) {
+	MutexLock tile_cache_lock(tile_cache_mutex);
+
+	NavMeshTileCache3D **tile_cache = tile_caches.getptr(p_navigation_mesh->get_instance_id());
+	if (tile_cache) {
+		return *tile_cache;
+	}
+	return tile_caches.insert(p_navigation_mesh->get_instance_id(), memnew(NavMeshTileCache3D))->value;
+}
+
+void NavMeshGenerator3D::generator_bake_tiles(NavMeshGeneratorTask3D *p_generator_task, const rcConfig &p_config, const float *p_vertices, int p_vertex_count, const int *p_indices, int p_triangle_count, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions) {
+	Ref<NavigationMesh> navigation_mesh = p_generator_task->navigation_mesh;
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CALC_GRID_SIZE; // step #2
+
+	// Tiles are aligned to the world origin, so that they stay in place when the source geometry grows or shrinks.
+	const int tile_cells = MAX(1, (int)Math::ceil(navigation_mesh->get_tile_size() / p_config.cs));
+	const float tile_world_size = tile_cells * p_config.cs;
+
+	// Every tile also rasterizes a border around itself, so that erosion and region partitioning
+	// at its edges see the geometry of its neighbors. The border itself is not part of the tile.
+	rcConfig tile_config = p_config;
+	tile_config.borderSize = p_config.walkableRadius + 3;
+	const float tile_padding = tile_config.borderSize * p_config.cs;
+
+	// Only clip tiles when the baked area is explicitly restricted, otherwise the outermost tiles
+	// would change every time the bounds of the source geometry do.
+	const bool has_baking_aabb = navigation_mesh->get_filter_baking_aabb().has_volume();
+	const bool clip_tiles = has_baking_aabb || p_config.borderSize > 0;
+	const float area_border = p_config.borderSize * p_config.cs;
+	const float area_min[2] = { p_config.bmin[0] + area_border, p_config.bmin[2] + area_border };
+	const float area_max[2] = { p_config.bmax[0] - area_border, p_config.bmax[2] - area_border };
+	if (area_min[0] >= area_max[0] || area_min[1] >= area_max[1]) {
+		navigation_mesh->clear();
+		return;
+	}
+
+	const Vector2i tile_range_min = Vector2i((int)Math::floor(area_min[0] / tile_world_size), (int)Math::floor(area_min[1] / tile_world_size));
+	const Vector2i tile_range_max = Vector2i((int)Math::floor(area_max[0] / tile_world_size), (int)Math::floor(area_max[1] / tile_world_size));
+
+	NavMeshTileBatch3D batch;
+	batch.navigation_mesh = navigation_mesh;
+	batch.config = &tile_config;
+	batch.vertices = p_vertices;
+	batch.vertex_count = p_vertex_count;
+	batch.projected_obstructions = &p_projected_obstructions;
+	batch.tile_world_size = tile_world_size;
+
+	// Hand every triangle to the tiles it may affect, and hash them so unchanged tiles can be skipped.
+	LocalVector<NavMeshTileBake3D> tile_bakes;
+	HashMap<Vector2i, uint32_t> tile_bake_indices;
+
+	for (int i = 0; i < p_triangle_count; i++) {
+		const int *triangle = &p_indices[i * 3];
+		const float *vertex_a = &p_vertices[triangle[0] * 3];
+		const float *vertex_b = &p_vertices[triangle[1] * 3];
+		const float *vertex_c = &p_vertices[triangle[2] * 3];
+
+		const float triangle_min_x = MIN(MIN(vertex_a[0], vertex_b[0]), vertex_c[0]);
+		const float triangle_max_x = MAX(MAX(vertex_a[0], vertex_b[0]), vertex_c[0]);
+		const float triangle_min_y = MIN(MIN(vertex_a[1], vertex_b[1]), vertex_c[1]);
+		const float triangle_max_y = MAX(MAX(vertex_a[1], vertex_b[1]), vertex_c[1]);
+		const float triangle_min_z = MIN(MIN(vertex_a[2], vertex_b[2]), vertex_c[2]);
+		const float triangle_max_z = MAX(MAX(vertex_a[2], vertex_b[2]), vertex_c[2]);
+
+		const int tile_min_x = MAX(tile_range_min.x, (int)Math::floor((triangle_min_x - tile_padding) / tile_world_size));
+		const int tile_max_x = MIN(tile_range_max.x, (int)Math::floor((triangle_max_x + tile_padding) / tile_world_size));
+		const int tile_min_z = MAX(tile_range_min.y, (int)Math::floor((triangle_min_z - tile_padding) / tile_world_size));
+		const int tile_max_z = MIN(tile_range_max.y, (int)Math::floor((triangle_max_z + tile_padding) / tile_world_size));
+
+		for (int z = tile_min_z; z <= tile_max_z; z++) {
+			for (int x = tile_min_x; x <= tile_max_x; x++) {
+				const Vector2i coords = Vector2i(x, z);
+				uint32_t *tile_bake_index = tile_bake_indices.getptr(coords);
+				if (!tile_bake_index) {
+					tile_bake_index = &tile_bake_indices.insert(coords, tile_bakes.size())->value;
+					tile_bakes.push_back(NavMeshTileBake3D());
+
+					NavMeshTileBake3D &tile_bake = tile_bakes[*tile_bake_index];
+					tile_bake.batch = &batch;
+					tile_bake.coords = coords;
+					tile_bake.bmin[0] = x * tile_world_size;
+					tile_bake.bmin[1] = triangle_min_y;
+					tile_bake.bmin[2] = z * tile_world_size;
+					tile_bake.bmax[0] = (x + 1) * tile_world_size;
+					tile_bake.bmax[1] = triangle_max_y;
+					tile_bake.bmax[2] = (z + 1) * tile_world_size;
+					if (clip_tiles) {
+						tile_bake.bmin[0] = MAX(tile_bake.bmin[0], area_min[0]);
+						tile_bake.bmin[2] = MAX(tile_bake.bmin[2], area_min[1]);
+						tile_bake.bmax[0] = MIN(tile_bake.bmax[0], area_max[0]);
+						tile_bake.bmax[2] = MIN(tile_bake.bmax[2], area_max[1]);
+					}
+				}
+
+				NavMeshTileBake3D &tile_bake = tile_bakes[*tile_bake_index];
+				tile_bake.bmin[1] = MIN(tile_bake.bmin[1], triangle_min_y);
+				tile_bake.bmax[1] = MAX(tile_bake.bmax[1], triangle_max_y);
+				for (int j = 0; j < 3; j++) {
+					tile_bake.source_indices.push_back(triangle[j]);
+					const float *vertex = &p_vertices[triangle[j] * 3];
+					tile_bake.source_hash = hash64_murmur3_bits(vertex[0], tile_bake.source_hash);
+					tile_bake.source_hash = hash64_murmur3_bits(vertex[1], tile_bake.source_hash);
+					tile_bake.source_hash = hash64_murmur3_bits(vertex[2], tile_bake.source_hash);
+				}
+			}
+		}
+	}
+
+	for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
+		if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 3 != 0) {
+			continue;
+		}
+
+		const float *obstruction_vertices = projected_obstruction.vertices.ptr();
+		float obstruction_min[2] = { obstruction_vertices[0], obstruction_vertices[2] };
+		float obstruction_max[2] = { obstruction_vertices[0], obstruction_vertices[2] };
+		for (int i = 3; i < projected_obstruction.vertices.size(); i += 3) {
+			obstruction_min[0] = MIN(obstruction_min[0], obstruction_vertices[i + 0]);
+			obstruction_min[1] = MIN(obstruction_min[1], obstruction_vertices[i + 2]);
+			obstruction_max[0] = MAX(obstruction_max[0], obstruction_vertices[i + 0]);
+			obstruction_max[1] = MAX(obstruction_max[1], obstruction_vertices[i + 2]);
+		}
+
+		const int tile_min_x = MAX(tile_range_min.x, (int)Math::floor((obstruction_min[0] - tile_padding) / tile_world_size));
+		const int tile_max_x = MIN(tile_range_max.x, (int)Math::floor((obstruction_max[0] + tile_padding) / tile_world_size));
+		const int tile_min_z = MAX(tile_range_min.y, (int)Math::floor((obstruction_min[1] - tile_padding) / tile_world_size));
+		const int tile_max_z = MIN(tile_range_max.y, (int)Math::floor((obstruction_max[1] + tile_padding) / tile_world_size));
+
+		for (int z = tile_min_z; z <= tile_max_z; z++) {
+			for (int x = tile_min_x; x <= tile_max_x; x++) {
+				const uint32_t *tile_bake_index = tile_bake_indices.getptr(Vector2i(x, z));
+				if (!tile_bake_index) {
+					continue;
+				}
+
+				NavMeshTileBake3D &tile_bake = tile_bakes[*tile_bake_index];
+				for (const float value : projected_obstruction.vertices) {
+					tile_bake.source_hash = hash64_murmur3_bits(value, tile_bake.source_hash);
+				}
+				tile_bake.source_hash = hash64_murmur3_bits(projected_obstruction.elevation, tile_bake.source_hash);
+				tile_bake.source_hash = hash64_murmur3_bits(projected_obstruction.height, tile_bake.source_hash);
+				tile_bake.source_hash = hash64_murmur3_64(projected_obstruction.carve, tile_bake.source_hash);
+			}
+		}
+	}
+
+	for (NavMeshTileBake3D &tile_bake : tile_bakes) {
+		if (has_baking_aabb) {
+			tile_bake.bmin[1] = p_config.bmin[1];
+			tile_bake.bmax[1] = p_config.bmax[1];
+		} else {
+			// Align the heightfields of all tiles, so that the heights of their shared edges match.
+			tile_bake.bmin[1] = Math::floor(tile_bake.bmin[1] / p_config.ch) * p_config.ch;
+		}
+		for (int i = 0; i < 3; i++) {
+			tile_bake.source_hash = hash64_murmur3_bits(tile_bake.bmin[i], tile_bake.source_hash);
+			tile_bake.source_hash = hash64_murmur3_bits(tile_bake.bmax[i], tile_bake.source_hash);
+		}
+	}
+
+	// Tiles baked with other settings can't be reused.
+	rcConfig settings_config = tile_config;
+	for (int i = 0; i < 3; i++) {
+		settings_config.bmin[i] = 0.0;
+		settings_config.bmax[i] = 0.0;
+	}
+	// The grid size of the whole bake only changes with the bounds of the source geometry.
+	settings_config.width = 0;
+	settings_config.height = 0;
+	uint32_t settings_hash = hash_murmur3_buffer(&settings_config, sizeof(rcConfig));
+	settings_hash = hash_murmur3_one_32(tile_cells, settings_hash);
+	settings_hash = hash_murmur3_one_32(navigation_mesh->get_sample_partition_type(), settings_hash);
+	settings_hash = hash_murmur3_one_32(navigation_mesh->get_filter_low_hanging_obstacles(), settings_hash);
+	settings_hash = hash_murmur3_one_32(navigation_mesh->get_filter_ledge_spans(), settings_hash);
+	settings_hash = hash_murmur3_one_32(navigation_mesh->get_filter_walkable_low_height_spans(), settings_hash);
+
+	NavMeshTileCache3D *tile_cache = generator_get_tile_cache(navigation_mesh);
+	if (tile_cache->settings_hash != settings_hash) {
+		tile_cache->settings_hash = settings_hash;
+		tile_cache->tiles.clear();
+	}
+
+	LocalVector<NavMeshTileBake3D *> dirty_tile_bakes;
+	for (NavMeshTileBake3D &tile_bake : tile_bakes) {
+		const NavMeshTile3D *cached_tile = tile_cache->tiles.getptr(tile_bake.coords);
+		if (!cached_tile || cached_tile->source_hash != tile_bake.source_hash) {
+			dirty_tile_bakes.push_back(&tile_bake);
+		}
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKING_TILES;
+
+	// Bake each tile in its own task. Waiting for them lets this thread help out if it's a pool thread itself.
+	if (use_threads && dirty_tile_bakes.size() > 1) {
+		for (NavMeshTileBake3D *tile_bake : dirty_tile_bakes) {
+			tile_bake->thread_task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavMeshGenerator3D::generator_thread_bake_tile, tile_bake, NavMeshGenerator3D::baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTile3D"));
+		}
+		for (NavMeshTileBake3D *tile_bake : dirty_tile_bakes) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(tile_bake->thread_task_id);
+		}
+	} else {
+		for (NavMeshTileBake3D *tile_bake : dirty_tile_bakes) {
+			generator_thread_bake_tile(tile_bake);
+		}
+	}
+
+	LocalVector<Vector2i> removed_tiles;
+	for (const KeyValue<Vector2i, NavMeshTile3D> &E : tile_cache->tiles) {
+		if (!tile_bake_indices.has(E.key)) {
+			removed_tiles.push_back(E.key);
+		}
+	}
+	for (const Vector2i &coords : removed_tiles) {
+		tile_cache->tiles.erase(coords);
+	}
+	for (NavMeshTileBake3D *tile_bake : dirty_tile_bakes) {
+		if (!tile_bake->baked) {
+			// Leave failed tiles out of the cache, so that they are baked again next time.
+			tile_cache->tiles.erase(tile_bake->coords);
+			continue;
+		}
+		NavMeshTile3D &tile = tile_cache->tiles[tile_bake->coords];
+		tile.source_hash = tile_bake->source_hash;
+		tile.vertices = std::move(tile_bake->tile.vertices);
+		tile.indices = std::move(tile_bake->tile.indices);
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	generator_merge_tiles(tile_cache, tile_world_size, (p_config.walkableClimb + 1) * p_config.ch, nav_vertices, nav_polygons);
+
+	navigation_mesh->set_data(nav_vertices, nav_polygons);
+
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
 }
 
+void NavMeshGenerator3D::generator_thread_bake_tile(void *p_arg) {
+	NavMeshTileBake3D *tile_bake = static_cast<NavMeshTileBake3D *>(p_arg);
+	const NavMeshTileBatch3D *batch = tile_bake->batch;
+
+	rcConfig cfg = *batch->config;
+	const float padding = cfg.borderSize * cfg.cs;
+	cfg.bmin[0] = tile_bake->bmin[0] - padding;
+	cfg.bmin[1] = tile_bake->bmin[1];
+	cfg.bmin[2] = tile_bake->bmin[2] - padding;
+	cfg.bmax[0] = tile_bake->bmax[0] + padding;
+	cfg.bmax[1] = tile_bake->bmax[1];
+	cfg.bmax[2] = tile_bake->bmax[2] + padding;
+	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+
+	NavMeshTile3D &tile = tile_bake->tile;
+	if (!generator_bake_recast(batch->navigation_mesh, cfg, batch->vertices, batch->vertex_count, tile_bake->source_indices.ptr(), tile_bake->source_indices.size() / 3, *batch->projected_obstructions, nullptr, tile.vertices, tile.indices)) {
+		tile.vertices.clear();
+		tile.indices.clear();
+		return;
+	}
+	tile_bake->baked = true;
+	baked_tile_count.increment();
+
+	// Neighboring tiles compute the vertices of their shared edges from different origins, snap them
+	// to the exact same positions so that the edges can be matched when the tiles are merged.
+	const real_t snap_distance = cfg.cs * 0.01;
+	for (Vector3 &vertex : tile.vertices) {
+		bool on_edge = false;
+		const real_t edge_x = Math::round(vertex.x / batch->tile_world_size) * batch->tile_world_size;
+		if (Math::abs(vertex.x - edge_x) < snap_distance) {
+			vertex.x = edge_x;
+			on_edge = true;
+		}
+		const real_t edge_z = Math::round(vertex.z / batch->tile_world_size) * batch->tile_world_size;
+		if (Math::abs(vertex.z - edge_z) < snap_distance) {
+			vertex.z = edge_z;
+			on_edge = true;
+		}
+		if (on_edge) {
+			vertex.y = Math::round(vertex.y / cfg.ch) * cfg.ch;
+		}
+	}
+}
+
+struct NavMeshTileEdgeVertex3D {
+	real_t position = 0.0;
+	int index = -1;
+
+	bool operator<(const NavMeshTileEdgeVertex3D &p_other) const {
+		return position < p_other.position;
+	}
+};
+
+void NavMeshGenerator3D::generator_merge_tiles(const NavMeshTileCache3D *p_tile_cache, float p_tile_world_size, float p_max_seam_height_difference, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	LocalVector<Vector2i> tile_coords;
+	tile_coords.reserve(p_tile_cache->tiles.size());
+	for (const KeyValue<Vector2i, NavMeshTile3D> &E : p_tile_cache->tiles) {
+		tile_coords.push_back(E.key);
+	}
+	tile_coords.sort();
+
+	LocalVector<Vector3> vertices;
+	LocalVector<LocalVector<int>> polygons;
+	HashMap<Vector3, int> vertex_indices;
+	LocalVector<int> tile_vertex_indices;
+
+	for (const Vector2i &coords : tile_coords) {
+		const NavMeshTile3D &tile = p_tile_cache->tiles[coords];
+
+		tile_vertex_indices.resize(tile.vertices.size());
+		for (uint32_t i = 0; i < tile.vertices.size(); i++) {
+			const int *existing_index = vertex_indices.getptr(tile.vertices[i]);
+			if (existing_index) {
+				tile_vertex_indices[i] = *existing_index;
+			} else {
+				tile_vertex_indices[i] = vertices.size();
+				vertex_indices.insert(tile.vertices[i], vertices.size());
+				vertices.push_back(tile.vertices[i]);
+			}
+		}
+
+		for (uint32_t i = 0; i + 2 < tile.indices.size(); i += 3) {
+			LocalVector<int> polygon;
+			polygon.resize(3);
+			polygon[0] = tile_vertex_indices[tile.indices[i + 0]];
+			polygon[1] = tile_vertex_indices[tile.indices[i + 1]];
+			polygon[2] = tile_vertex_indices[tile.indices[i + 2]];
+			polygons.push_back(polygon);
+		}
+	}
+
+	// Tiles are partitioned independently, so one side of a tile edge can have vertices the other side
+	// doesn't. Navigation regions only connect edges with matching vertices, so insert the vertices of
+	// both sides into the polygons of both sides.
+	HashMap<int, LocalVector<NavMeshTileEdgeVertex3D>> x_edge_vertices; // Sorted along z.
+	HashMap<int, LocalVector<NavMeshTileEdgeVertex3D>> z_edge_vertices; // Sorted along x.
+	for (uint32_t i = 0; i < vertices.size(); i++) {
+		const Vector3 &vertex = vertices[i];
+		const real_t edge_x = Math::round(vertex.x / p_tile_world_size);
+		if (vertex.x == edge_x * p_tile_world_size) {
+			x_edge_vertices[(int)edge_x].push_back({ vertex.z, (int)i });
+		}
+		const real_t edge_z = Math::round(vertex.z / p_tile_world_size);
+		if (vertex.z == edge_z * p_tile_world_size) {
+			z_edge_vertices[(int)edge_z].push_back({ vertex.x, (int)i });
+		}
+	}
+	for (KeyValue<int, LocalVector<NavMeshTileEdgeVertex3D>> &E : x_edge_vertices) {
+		E.value.sort();
+	}
+	for (KeyValue<int, LocalVector<NavMeshTileEdgeVertex3D>> &E : z_edge_vertices) {
+		E.value.sort();
+	}
+
+	LocalVector<int> split_polygon;
+	LocalVector<int> edge_splits;
+	for (LocalVector<int> &polygon : polygons) {
+		split_polygon.clear();
+		for (uint32_t i = 0; i < polygon.size(); i++) {
+			const int index_a = polygon[i];
+			const int index_b = polygon[(i + 1) % polygon.size()];
+			const Vector3 &vertex_a = vertices[index_a];
+			const Vector3 &vertex_b = vertices[index_b];
+			split_polygon.push_back(index_a);
+
+			// Find the tile edge both vertices are on, if any.
+			const LocalVector<NavMeshTileEdgeVertex3D> *edge_vertices = nullptr;
+			real_t position_a = 0.0;
+			real_t position_b = 0.0;
+			const real_t edge_x = Math::round(vertex_a.x / p_tile_world_size);
+			const real_t edge_z = Math::round(vertex_a.z / p_tile_world_size);
+			if (vertex_a.x == vertex_b.x && vertex_a.x == edge_x * p_tile_world_size) {
+				edge_vertices = x_edge_vertices.getptr((int)edge_x);
+				position_a = vertex_a.z;
+				position_b = vertex_b.z;
+			} else if (vertex_a.z == vertex_b.z && vertex_a.z == edge_z * p_tile_world_size) {
+				edge_vertices = z_edge_vertices.getptr((int)edge_z);
+				position_a = vertex_a.x;
+				position_b = vertex_b.x;
+			}
+			if (!edge_vertices || position_a == position_b) {
+				continue;
+			}
+
+			const real_t position_min = MIN(position_a, position_b);
+			const real_t position_max = MAX(position_a, position_b);
+
+			// Binary search the first vertex past the start of the edge.
+			uint32_t low = 0;
+			uint32_t high = edge_vertices->size();
+			while (low < high) {
+				const uint32_t middle = (low + high) / 2;
+				if ((*edge_vertices)[middle].position <= position_min) {
+					low = middle + 1;
+				} else {
+					high = middle;
+				}
+			}
+
+			edge_splits.clear();
+			for (uint32_t j = low; j < edge_vertices->size() && (*edge_vertices)[j].position < position_max; j++) {
+				const NavMeshTileEdgeVertex3D &edge_vertex = (*edge_vertices)[j];
+				// Skip vertices of other floors crossing the same tile edge.
+				const real_t weight = (edge_vertex.position - position_a) / (position_b - position_a);
+				const real_t edge_height = Math::lerp(vertex_a.y, vertex_b.y, weight);
+				if (Math::abs(vertices[edge_vertex.index].y - edge_height) <= p_max_seam_height_difference) {
+					edge_splits.push_back(edge_vertex.index);
+				}
+			}
+			if (position_a > position_b) {
+				edge_splits.reverse();
+			}
+			for (const int split_index : edge_splits) {
+				split_polygon.push_back(split_index);
+			}
+		}
+		if (split_polygon.size() != polygon.size()) {
+			polygon = split_polygon;
+		}
+	}
+
+	r_vertices.resize(vertices.size());
+	Vector3 *vertices_ptrw = r_vertices.ptrw();
+	for (uint32_t i = 0; i < vertices.size(); i++) {
+		vertices_ptrw[i] = vertices[i];
+	}
+
+	r_polygons.resize(polygons.size());
+	Vector<int> *polygons_ptrw = r_polygons.ptrw();
+	for (uint32_t i = 0; i < polygons.size(); i++) {
+		polygons_ptrw[i].resize(polygons[i].size());
+		int *polygon_ptrw = polygons_ptrw[i].ptrw();
+		for (uint32_t j = 0; j < polygons[i].size(); j++) {
+			polygon_ptrw[j] = polygons[i][j];
+		}
+	}
+}
+
 bool NavMeshGenerator3D::generator_emit_callback(const Callable &p_callback) {
 	ERR_FAIL_COND_V(!p_callback.is_valid(), false);
 
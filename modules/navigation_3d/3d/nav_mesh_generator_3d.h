@@ -38,6 +38,7 @@
 class Node;
 class NavigationMesh;
 class NavigationMeshSourceGeometryData3D;
+struct rcConfig;
 
 class NavMeshGenerator3D : public Object {
 	static NavMeshGenerator3D *singleton;
@@ -67,6 +68,7 @@ public:
 		BAKE_STATE_CONVERTING_NATIVE_NAVMESH,
 		BAKE_STATE_BAKE_CLEANUP,
 		BAKE_STATE_BAKE_FINISHED,
+		BAKE_STATE_BAKING_TILES,
 		BAKE_STATE_MAX,
 	};
 
@@ -93,11 +95,57 @@ private:
 
 	static void generator_thread_bake(void *p_arg);
 
+	struct NavMeshTile3D {
+		uint64_t source_hash = 0;
+		LocalVector<Vector3> vertices;
+		LocalVector<int> indices;
+	};
+
+	// The tiles of the last bake of a navigation mesh, reused when their source geometry didn't change.
+	struct NavMeshTileCache3D {
+		uint32_t settings_hash = 0;
+		HashMap<Vector2i, NavMeshTile3D> tiles;
+	};
+
+	struct NavMeshTileBatch3D;
+
+	struct NavMeshTileBake3D {
+		const NavMeshTileBatch3D *batch = nullptr;
+		Vector2i coords;
+		float bmin[3] = {};
+		float bmax[3] = {};
+		uint64_t source_hash = HASH_MURMUR3_SEED;
+		LocalVector<int> source_indices;
+		NavMeshTile3D tile;
+		bool baked = false;
+		WorkerThreadPool::TaskID thread_task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
+	struct NavMeshTileBatch3D {
+		Ref<NavigationMesh> navigation_mesh;
+		const rcConfig *config = nullptr;
+		const float *vertices = nullptr;
+		int vertex_count = 0;
+		const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> *projected_obstructions = nullptr;
+		float tile_world_size = 0.0;
+	};
+
+	static Mutex tile_cache_mutex;
+	static HashMap<ObjectID, NavMeshTileCache3D *> tile_caches;
+	static SafeNumeric<uint32_t> baked_tile_count;
+
+	static void generator_evict_freed_tile_caches();
+	static NavMeshTileCache3D *generator_get_tile_cache(const Ref<NavigationMesh> &p_navigation_mesh);
+	static void generator_thread_bake_tile(void *p_arg);
+	static void generator_bake_tiles(NavMeshGeneratorTask3D *p_generator_task, const rcConfig &p_config, const float *p_vertices, int p_vertex_count, const int *p_indices, int p_triangle_count, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions);
+	static void generator_merge_tiles(const NavMeshTileCache3D *p_tile_cache, float p_tile_world_size, float p_max_seam_height_difference, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
+
 	static HashMap<Ref<NavigationMesh>, NavMeshGeneratorTask3D *> baking_navmeshes;
 
 	static void generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children);
 	static void generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node);
 	static void generator_bake_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task);
+	static bool generator_bake_recast(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_config, const float *p_vertices, int p_vertex_count, const int *p_indices, int p_triangle_count, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, NavMeshBakeState *r_bake_state, LocalVector<Vector3> &r_vertices, LocalVector<int> &r_indices);
 
 	static bool generator_emit_callback(const Callable &p_callback);
 
@@ -116,6 +164,9 @@ public:
 	static bool is_baking(Ref<NavigationMesh> p_navigation_mesh);
 	static String get_baking_state_msg(Ref<NavigationMesh> p_navigation_mesh);
 
+	// Number of tiles baked with Recast so far, tiles reused from the cache aren't counted.
+	static uint32_t get_baked_tile_count();
+
 	NavMeshGenerator3D();
 	~NavMeshGenerator3D();
 };
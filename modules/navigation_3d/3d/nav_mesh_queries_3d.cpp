@@ -186,6 +186,9 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 		case NavigationPathQueryParameters3D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR: {
 			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
+		case NavigationPathQueryParameters3D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR: {
+			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR;
+		} break;
 		default: {
 			WARN_PRINT("No match for used PathfindingAlgorithm - fallback to default");
 			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
@@ -289,13 +292,20 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 			&traversable_polys = p_query_task.path_query_slot->traversable_polys;
 	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
 
+	const uint32_t neighbor_poly_id = p_query_task.path_query_slot->poly_to_id[p_connection.polygon];
+	NavigationPoly &neighbor_poly = navigation_polys[neighbor_poly_id];
+
+	// Stay inside the clusters of the coarse route when searching hierarchically.
+	if (p_query_task.use_cluster_corridor && neighbor_poly.cluster_id != UINT32_MAX && !p_query_task.path_query_slot->cluster_corridor[neighbor_poly.cluster_id].in_corridor) {
+		return;
+	}
+
 	real_t poly_travel_cost = p_least_cost_poly.poly->owner->get_travel_cost();
 
 	Vector3 new_entry = Geometry3D::get_closest_point_to_segment(p_least_cost_poly.entry, p_connection.pathway_start, p_connection.pathway_end);
 	real_t new_traveled_distance = p_least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost + p_poly_enter_cost + p_least_cost_poly.traveled_distance;
 
 	// Check if the neighbor polygon has already been processed.
-	NavigationPoly &neighbor_poly = navigation_polys[p_query_task.path_query_slot->poly_to_id[p_connection.polygon]];
 	if (new_traveled_distance < neighbor_poly.traveled_distance) {
 		// Add the polygon to the heap of polygons to traverse next.
 		neighbor_poly.back_navigation_poly_id = p_least_cost_id;
@@ -311,12 +321,97 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 		if (neighbor_poly.traversable_poly_index != traversable_polys.INVALID_INDEX) {
 			traversable_polys.shift(neighbor_poly.traversable_poly_index);
 		} else {
+			if (neighbor_poly.poly == nullptr) {
+				p_query_task.path_query_slot->path_corridor_touched_ids.push_back(neighbor_poly_id);
+			}
 			neighbor_poly.poly = p_connection.polygon;
 			traversable_polys.push(&neighbor_poly);
 		}
 	}
 }
 
+bool NavMeshQueries3D::_query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	const LocalVector<Cluster> &clusters = p_map_iteration.clusters;
+	const LocalVector<ClusterConnection> &cluster_connections = p_map_iteration.cluster_connections;
+
+	PathQuerySlot *path_query_slot = p_query_task.path_query_slot;
+	const LocalVector<NavigationPoly> &navigation_polys = path_query_slot->path_corridor;
+	const uint32_t begin_cluster_id = navigation_polys[path_query_slot->poly_to_id[p_query_task.begin_polygon]].cluster_id;
+	const uint32_t end_cluster_id = navigation_polys[path_query_slot->poly_to_id[p_query_task.end_polygon]].cluster_id;
+
+	// Nothing to gain from the cluster graph when both polygons share a cluster.
+	if (begin_cluster_id == UINT32_MAX || end_cluster_id == UINT32_MAX || begin_cluster_id == end_cluster_id) {
+		return false;
+	}
+
+	LocalVector<NavigationCluster> &navigation_clusters = path_query_slot->cluster_corridor;
+	for (NavigationCluster &navigation_cluster : navigation_clusters) {
+		navigation_cluster.reset();
+	}
+
+	Heap<NavigationCluster *, NavClusterTravelCostGreaterThan, NavClusterHeapIndexer> &traversable_clusters = path_query_slot->traversable_clusters;
+	traversable_clusters.clear();
+
+	const Vector3 &end_center = clusters[end_cluster_id].center;
+	const real_t heuristic_travel_cost = p_map_iteration.cluster_min_travel_cost;
+
+	NavigationCluster &begin_navigation_cluster = navigation_clusters[begin_cluster_id];
+	begin_navigation_cluster.traveled_distance = 0.0;
+	begin_navigation_cluster.distance_to_destination = clusters[begin_cluster_id].center.distance_to(end_center) * heuristic_travel_cost;
+	traversable_clusters.push(&begin_navigation_cluster);
+
+	// A* on the cluster graph.
+	bool found_route = false;
+	while (!traversable_clusters.is_empty()) {
+		const NavigationCluster *least_cost_cluster = traversable_clusters.pop();
+		const uint32_t least_cost_id = least_cost_cluster - navigation_clusters.ptr();
+		if (least_cost_id == end_cluster_id) {
+			found_route = true;
+			break;
+		}
+
+		const Cluster &cluster = clusters[least_cost_id];
+		for (uint32_t connection_index = cluster.connections_begin; connection_index < cluster.connections_end; connection_index++) {
+			const ClusterConnection &connection = cluster_connections[connection_index];
+			NavigationCluster &neighbor_cluster = navigation_clusters[connection.cluster];
+
+			const real_t new_traveled_distance = least_cost_cluster->traveled_distance + connection.cost;
+			if (new_traveled_distance < neighbor_cluster.traveled_distance) {
+				neighbor_cluster.back_navigation_cluster_id = least_cost_id;
+				neighbor_cluster.traveled_distance = new_traveled_distance;
+				neighbor_cluster.distance_to_destination = clusters[connection.cluster].center.distance_to(end_center) * heuristic_travel_cost;
+
+				if (neighbor_cluster.traversable_cluster_index != traversable_clusters.INVALID_INDEX) {
+					traversable_clusters.shift(neighbor_cluster.traversable_cluster_index);
+				} else {
+					traversable_clusters.push(&neighbor_cluster);
+				}
+			}
+		}
+	}
+
+	if (!found_route) {
+		// Leave unreachable targets to the regular search, it finds the closest reachable polygon.
+		return false;
+	}
+
+	// Open the clusters along the route and their direct neighbors, so the
+	// polygon search is not forced through the cluster centers.
+	int cluster_id = end_cluster_id;
+	while (cluster_id != -1) {
+		navigation_clusters[cluster_id].in_corridor = true;
+
+		const Cluster &cluster = clusters[cluster_id];
+		for (uint32_t connection_index = cluster.connections_begin; connection_index < cluster.connections_end; connection_index++) {
+			navigation_clusters[cluster_connections[connection_index].cluster].in_corridor = true;
+		}
+
+		cluster_id = navigation_clusters[cluster_id].back_navigation_cluster_id;
+	}
+
+	return true;
+}
+
 void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	const Vector3 p_target_position = p_query_task.target_position;
 	const Polygon *begin_poly = p_query_task.begin_polygon;
@@ -329,12 +424,16 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 			&traversable_polys = p_query_task.path_query_slot->traversable_polys;
 	traversable_polys.clear();
 
+	// Only the polygons touched by the previous search need a reset.
 	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
-	for (NavigationPoly &polygon : navigation_polys) {
-		polygon.reset();
+	LocalVector<uint32_t> &touched_poly_ids = p_query_task.path_query_slot->path_corridor_touched_ids;
+	for (uint32_t touched_poly_id : touched_poly_ids) {
+		navigation_polys[touched_poly_id].reset();
 	}
+	touched_poly_ids.clear();
 
 	// Initialize the matching navigation polygon.
+	touched_poly_ids.push_back(p_query_task.path_query_slot->poly_to_id[begin_poly]);
 	NavigationPoly &begin_navigation_poly = navigation_polys[p_query_task.path_query_slot->poly_to_id[begin_poly]];
 	begin_navigation_poly.poly = begin_poly;
 	begin_navigation_poly.entry = begin_point;
@@ -401,6 +500,14 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
+			if (p_query_task.use_cluster_corridor && !path_search_max_reached) {
+				// The end polygon is not reachable inside the cluster corridor, e.g. due to navigation layers
+				// or excluded regions. Let the caller repeat the search on all polygons.
+				p_query_task.use_cluster_corridor = false;
+				p_query_task.cluster_corridor_failed = true;
+				return;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -447,9 +554,9 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 				return;
 			}
 
-			for (NavigationPoly &nav_poly : navigation_polys) {
-				nav_poly.poly = nullptr;
-				nav_poly.traveled_distance = FLT_MAX;
+			for (uint32_t touched_poly_id : touched_poly_ids) {
+				navigation_polys[touched_poly_id].poly = nullptr;
+				navigation_polys[touched_poly_id].traveled_distance = FLT_MAX;
 			}
 			uint32_t _bp_id = p_query_task.path_query_slot->poly_to_id[begin_poly];
 			navigation_polys[_bp_id].poly = begin_poly;
@@ -531,8 +638,16 @@ void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D
 		return;
 	}
 
+	if (p_query_task.pathfinding_algorithm == PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR) {
+		p_query_task.use_cluster_corridor = _query_task_build_cluster_corridor(p_query_task, p_map_iteration);
+	}
+
 	_query_task_build_path_corridor(p_query_task, p_map_iteration);
 
+	if (p_query_task.cluster_corridor_failed) {
+		_query_task_build_path_corridor(p_query_task, p_map_iteration);
+	}
+
 	if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
 		_query_task_process_path_result_limits(p_query_task);
 		return;
@@ -49,6 +49,10 @@ public:
 	struct PathQuerySlot {
 		LocalVector<Nav3D::NavigationPoly> path_corridor;
 		Heap<Nav3D::NavigationPoly *, Nav3D::NavPolyTravelCostGreaterThan, Nav3D::NavPolyHeapIndexer> traversable_polys;
+		// Ids of the path corridor polys changed by the last search, so only those need a reset.
+		LocalVector<uint32_t> path_corridor_touched_ids;
+		LocalVector<Nav3D::NavigationCluster> cluster_corridor;
+		Heap<Nav3D::NavigationCluster *, Nav3D::NavClusterTravelCostGreaterThan, Nav3D::NavClusterHeapIndexer> traversable_clusters;
 		bool in_use = false;
 		uint32_t slot_index = 0;
 		AHashMap<const Nav3D::Polygon *, uint32_t> poly_to_id;
@@ -89,6 +93,8 @@ public:
 		const Nav3D::Polygon *begin_polygon = nullptr;
 		const Nav3D::Polygon *end_polygon = nullptr;
 		uint32_t least_cost_id = 0;
+		bool use_cluster_corridor = false;
+		bool cluster_corridor_failed = false;
 
 		// Map.
 		Vector3 map_up;
@@ -144,6 +150,7 @@ public:
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const Nav3D::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static bool _query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask3D &p_query_task);
@@ -126,6 +126,15 @@ void NavMap3D::set_link_connection_radius(real_t p_link_connection_radius) {
 	iteration_dirty = true;
 }
 
+void NavMap3D::set_hierarchical_cluster_size(real_t p_cluster_size) {
+	p_cluster_size = MAX(p_cluster_size, 0.0);
+	if (hierarchical_cluster_size == p_cluster_size) {
+		return;
+	}
+	hierarchical_cluster_size = p_cluster_size;
+	iteration_dirty = true;
+}
+
 const Vector3 &NavMap3D::get_merge_rasterizer_cell_size() const {
 	return merge_rasterizer_cell_size;
 }
@@ -368,6 +377,7 @@ void NavMap3D::_build_iteration() {
 	iteration_build.use_edge_connections = get_use_edge_connections();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
+	iteration_build.cluster_size = hierarchical_cluster_size;
 
 	next_map_iteration.clear();
 
@@ -857,6 +867,7 @@ NavMap3D::NavMap3D() {
 	avoidance_use_high_priority_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_high_priority_threads");
 
 	path_query_slots_max = GLOBAL_GET("navigation/pathfinding/max_threads");
+	hierarchical_cluster_size = GLOBAL_GET("navigation/3d/hierarchical_pathfinding_cluster_size");
 
 	int processor_count = OS::get_singleton()->get_processor_count();
 	if (path_query_slots_max < 0) {
@@ -136,6 +136,7 @@ class NavMap3D : public NavRid3D {
 	} async_dirty_requests;
 
 	int path_query_slots_max = 4;
+	real_t hierarchical_cluster_size = 0.0;
 
 	bool use_async_iterations = true;
 
@@ -193,6 +194,11 @@ public:
 		return link_connection_radius;
 	}
 
+	void set_hierarchical_cluster_size(real_t p_cluster_size);
+	real_t get_hierarchical_cluster_size() const {
+		return hierarchical_cluster_size;
+	}
+
 	Nav3D::PointKey get_point_key(const Vector3 &p_pos) const;
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
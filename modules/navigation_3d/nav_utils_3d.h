@@ -113,6 +113,9 @@ struct NavigationPoly {
 	/// Index in the heap of traversable polygons.
 	uint32_t traversable_poly_index = UINT32_MAX;
 
+	/// Cluster of the map cluster graph that contains this poly, kept between queries.
+	uint32_t cluster_id = UINT32_MAX;
+
 	/// Those 4 variables are used to travel the path backwards.
 	int back_navigation_poly_id = -1;
 	int back_navigation_edge = -1;
@@ -171,6 +174,75 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+struct Cluster {
+	/// The average center of the polygons inside this cluster.
+	Vector3 center;
+
+	/// The lowest travel cost of the polygons inside this cluster.
+	real_t travel_cost = FLT_MAX;
+
+	/// Range of the outgoing connections of this cluster in the map cluster connections.
+	uint32_t connections_begin = 0;
+	uint32_t connections_end = 0;
+};
+
+struct ClusterConnection {
+	/// Cluster that this connection leads to.
+	uint32_t cluster = UINT32_MAX;
+
+	/// Travel cost between the centers of both clusters.
+	real_t cost = 0.0;
+};
+
+struct NavigationCluster {
+	/// Index in the heap of traversable clusters.
+	uint32_t traversable_cluster_index = UINT32_MAX;
+
+	/// Used to travel the cluster route backwards.
+	int back_navigation_cluster_id = -1;
+
+	/// The distance traveled until now (g cost).
+	real_t traveled_distance = FLT_MAX;
+	/// The distance to the destination (h cost).
+	real_t distance_to_destination = 0.0;
+
+	/// True if the polygon search may enter this cluster.
+	bool in_corridor = false;
+
+	/// The total travel cost (f cost).
+	real_t total_travel_cost() const {
+		return traveled_distance + distance_to_destination;
+	}
+
+	void reset() {
+		traversable_cluster_index = UINT32_MAX;
+		back_navigation_cluster_id = -1;
+		traveled_distance = FLT_MAX;
+		distance_to_destination = 0.0;
+		in_corridor = false;
+	}
+};
+
+struct NavClusterTravelCostGreaterThan {
+	// Returns `true` if the travel cost of `a` is higher than that of `b`.
+	bool operator()(const NavigationCluster *p_cluster_a, const NavigationCluster *p_cluster_b) const {
+		real_t f_cost_a = p_cluster_a->total_travel_cost();
+		real_t f_cost_b = p_cluster_b->total_travel_cost();
+
+		if (f_cost_a != f_cost_b) {
+			return f_cost_a > f_cost_b;
+		} else {
+			return p_cluster_a->distance_to_destination > p_cluster_b->distance_to_destination;
+		}
+	}
+};
+
+struct NavClusterHeapIndexer {
+	void operator()(NavigationCluster *p_cluster, uint32_t p_heap_index) const {
+		p_cluster->traversable_cluster_index = p_heap_index;
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
@@ -240,7 +240,7 @@ void Label3D::_queue_update() {
 	}
 
 	pending_update = true;
-	callable_mp(this, &Label3D::_im_update).call_deferred();
+	callable_mp(this, &Label3D::_im_update).call_deferred_coalesced();
 }
 
 AABB Label3D::get_aabb() const {
@@ -852,7 +852,7 @@ void Node3D::update_gizmos() {
 		return;
 	}
 	data.gizmos_dirty = true;
-	callable_mp(this, &Node3D::_update_gizmos).call_deferred();
+	callable_mp(this, &Node3D::_update_gizmos).call_deferred_coalesced();
 #endif
 }
 
@@ -136,7 +136,7 @@ void Container::queue_sort() {
 		return;
 	}
 
-	callable_mp(this, &Container::_sort_children).call_deferred();
+	callable_mp(this, &Container::_sort_children).call_deferred_coalesced();
 	pending_sort = true;
 }
 
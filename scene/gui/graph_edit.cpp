@@ -300,7 +300,7 @@ Error GraphEdit::connect_node(const StringName &p_from, int p_from_port, const S
 	minimap->queue_redraw();
 	queue_redraw();
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 
 	return OK;
 }
@@ -335,7 +335,7 @@ void GraphEdit::disconnect_node(const StringName &p_from, int p_from_port, const
 		minimap->queue_redraw();
 		queue_redraw();
 		connections_layer->queue_redraw();
-		callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+		callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 	}
 }
 
@@ -419,7 +419,7 @@ void GraphEdit::set_scroll_offset(const Vector2 &p_offset) {
 	minimap->queue_redraw();
 	queue_redraw();
 	_update_scrollbars();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 	setting_scroll_offset = false;
 }
 
@@ -436,7 +436,7 @@ void GraphEdit::_scrollbar_moved(double) {
 	}
 	minimap->queue_redraw();
 	queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 }
 
 void GraphEdit::_update_scroll_offset() {
@@ -630,7 +630,7 @@ void GraphEdit::_graph_frame_autoshrink_changed(const Vector2 &p_new_minsize, Gr
 	minimap->queue_redraw();
 	queue_redraw();
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 }
 
 void GraphEdit::_graph_element_moved(Node *p_node) {
@@ -641,7 +641,7 @@ void GraphEdit::_graph_element_moved(Node *p_node) {
 	minimap->queue_redraw();
 	queue_redraw();
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 }
 
 void GraphEdit::_graph_node_slot_updated(int p_index, Node *p_node) {
@@ -657,7 +657,7 @@ void GraphEdit::_graph_node_slot_updated(int p_index, Node *p_node) {
 	minimap->queue_redraw();
 	queue_redraw();
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 }
 
 void GraphEdit::_graph_node_rect_changed(GraphNode *p_node) {
@@ -672,7 +672,7 @@ void GraphEdit::_graph_node_rect_changed(GraphNode *p_node) {
 		conn->_cache.dirty = true;
 	}
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 
 	// Update all parent frames recursively bottom-up.
 	if (linked_parent_map.has(p_node->get_name())) {
@@ -874,7 +874,7 @@ void GraphEdit::_notification(int p_what) {
 		case NOTIFICATION_RESIZED: {
 			_update_scrollbars();
 			minimap->queue_redraw();
-			callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+			callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 		} break;
 
 		case NOTIFICATION_ENTER_TREE: {
@@ -1337,7 +1337,7 @@ void GraphEdit::_top_connection_layer_input(const Ref<InputEvent> &p_ev) {
 	if (mm.is_valid() && connecting && !keyboard_connecting) {
 		connecting_to_point = mm->get_position();
 		minimap->queue_redraw();
-		callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+		callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 
 		connecting_valid = just_disconnected || click_pos.distance_to(connecting_to_point / zoom) > MIN_DRAG_DISTANCE_FOR_VALID_CONNECTION;
 
@@ -2171,7 +2171,7 @@ void GraphEdit::gui_input(const Ref<InputEvent> &p_ev) {
 			minimap->queue_redraw();
 			queue_redraw();
 			connections_layer->queue_redraw();
-			callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+			callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 		}
 
 		// Node selection logic.
@@ -2341,7 +2341,7 @@ void GraphEdit::_pan_callback(Vector2 p_scroll_vec, Ref<InputEvent> p_event) {
 	}
 	minimap->queue_redraw();
 	queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 	connections_layer->queue_redraw();
 }
 
@@ -2363,7 +2363,7 @@ void GraphEdit::set_connection_activity(const StringName &p_from, int p_from_por
 				minimap->queue_redraw();
 				conn->_cache.dirty = true;
 				connections_layer->queue_redraw();
-				callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+				callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 			}
 			conn->activity = p_activity;
 			return;
@@ -2412,7 +2412,7 @@ void GraphEdit::force_connection_drag_end() {
 	minimap->queue_redraw();
 	queue_redraw();
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 	emit_signal(SNAME("connection_drag_ended"));
 }
 
@@ -2447,7 +2447,7 @@ void GraphEdit::set_zoom_custom(float p_zoom, const Vector2 &p_center) {
 
 	zoom = p_zoom;
 
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 
 	zoom_minus_button->set_disabled(zoom == zoom_min);
 	zoom_plus_button->set_disabled(zoom == zoom_max);
@@ -2884,7 +2884,7 @@ void GraphEdit::override_connections_shader(const Ref<Shader> &p_shader) {
 	_invalidate_connection_line_cache();
 	connections_layer->queue_redraw();
 	minimap->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred_coalesced();
 }
 
 void GraphEdit::_minimap_toggled() {
@@ -506,7 +506,7 @@ void TabContainer::_on_tab_hovered(int p_tab) {
 }
 
 void TabContainer::_on_tab_changed(int p_tab) {
-	callable_mp(this, &TabContainer::_repaint).call_deferred();
+	callable_mp(this, &TabContainer::_repaint).call_deferred_coalesced();
 	queue_redraw();
 
 	emit_signal(SNAME("tab_changed"), p_tab);
@@ -514,7 +514,7 @@ void TabContainer::_on_tab_changed(int p_tab) {
 
 void TabContainer::_on_tab_selected(int p_tab) {
 	if (p_tab != get_previous_tab()) {
-		callable_mp(this, &TabContainer::_repaint).call_deferred();
+		callable_mp(this, &TabContainer::_repaint).call_deferred_coalesced();
 	}
 
 	emit_signal(SNAME("tab_selected"), p_tab);
@@ -608,7 +608,7 @@ void TabContainer::add_child_notify(Node *p_child) {
 
 	// TabBar won't emit the "tab_changed" signal when not inside the tree.
 	if (!is_inside_tree()) {
-		callable_mp(this, &TabContainer::_repaint).call_deferred();
+		callable_mp(this, &TabContainer::_repaint).call_deferred_coalesced();
 	}
 }
 
@@ -668,7 +668,7 @@ void TabContainer::remove_child_notify(Node *p_child) {
 
 	// TabBar won't emit the "tab_changed" signal when not inside the tree.
 	if (!is_inside_tree()) {
-		callable_mp(this, &TabContainer::_repaint).call_deferred();
+		callable_mp(this, &TabContainer::_repaint).call_deferred_coalesced();
 	}
 }
 
@@ -766,7 +766,7 @@ void TabContainer::set_tabs_position(TabPosition p_tabs_position) {
 
 	tab_bar->set_tab_style_v_flip(tabs_position == POSITION_BOTTOM);
 
-	callable_mp(this, &TabContainer::_repaint).call_deferred();
+	callable_mp(this, &TabContainer::_repaint).call_deferred_coalesced();
 	queue_redraw();
 }
 
@@ -798,7 +798,7 @@ void TabContainer::set_tabs_visible(bool p_visible) {
 	tabs_visible = p_visible;
 	tab_bar->set_visible(tabs_visible);
 
-	callable_mp(this, &TabContainer::_repaint).call_deferred();
+	callable_mp(this, &TabContainer::_repaint).call_deferred_coalesced();
 	queue_redraw();
 }
 
@@ -917,7 +917,7 @@ void TabContainer::set_tab_hidden(int p_tab, bool p_hidden) {
 	if (!get_clip_tabs()) {
 		update_minimum_size();
 	}
-	callable_mp(this, &TabContainer::_repaint).call_deferred();
+	callable_mp(this, &TabContainer::_repaint).call_deferred_coalesced();
 }
 
 bool TabContainer::is_tab_hidden(int p_tab) const {
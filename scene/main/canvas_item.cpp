@@ -460,7 +460,7 @@ void CanvasItem::queue_redraw() {
 
 	pending_update = true;
 
-	callable_mp(this, &CanvasItem::_redraw_callback).call_deferred();
+	callable_mp(this, &CanvasItem::_redraw_callback).call_deferred_coalesced();
 }
 
 void CanvasItem::move_to_front() {
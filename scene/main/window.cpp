@@ -1795,7 +1795,7 @@ void Window::child_controls_changed() {
 	}
 
 	updating_child_controls = true;
-	callable_mp(this, &Window::_update_child_controls).call_deferred();
+	callable_mp(this, &Window::_update_child_controls).call_deferred_coalesced();
 }
 
 void Window::_update_child_controls() {
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/math/math_funcs.h"
+#include "core/math/vector3_batch.h"
 #include "scene/resources/theme.h"
 #include "scene/theme/theme_db.h"
 #include "servers/rendering_server.h"
@@ -55,20 +56,9 @@ void PrimitiveMesh::_update() const {
 
 	ERR_FAIL_COND_MSG(points.is_empty(), "_create_mesh_array must return at least a vertex array.");
 
-	aabb = AABB();
-
 	int pc = points.size();
 	ERR_FAIL_COND(pc == 0);
-	{
-		const Vector3 *r = points.ptr();
-		for (int i = 0; i < pc; i++) {
-			if (i == 0) {
-				aabb.position = r[i];
-			} else {
-				aabb.expand_to(r[i]);
-			}
-		}
-	}
+	aabb = Vector3Batch::get_aabb(points.ptr(), pc);
 
 	Vector<int> indices = arr[RS::ARRAY_INDEX];
 
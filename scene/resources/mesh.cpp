@@ -581,15 +581,11 @@ Ref<ConcavePolygonShape3D> Mesh::create_trimesh_shape() const {
 		return Ref<ConcavePolygonShape3D>();
 	}
 
+	// Face3 is three consecutive vertices, so the faces can be copied as a whole.
+	static_assert(sizeof(Face3) == sizeof(Vector3) * 3);
 	Vector<Vector3> face_points;
 	face_points.resize(faces.size() * 3);
-
-	for (int i = 0; i < face_points.size(); i += 3) {
-		Face3 f = faces.get(i / 3);
-		face_points.set(i, f.vertex[0]);
-		face_points.set(i + 1, f.vertex[1]);
-		face_points.set(i + 2, f.vertex[2]);
-	}
+	memcpy((void *)face_points.ptrw(), faces.ptr(), faces.size() * sizeof(Face3));
 
 	Ref<ConcavePolygonShape3D> shape = memnew(ConcavePolygonShape3D);
 	shape->set_faces(face_points);
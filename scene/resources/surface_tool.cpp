@@ -30,6 +30,7 @@
 
 #include "surface_tool.h"
 
+#include "core/math/vector3_batch.h"
 #include "core/templates/a_hash_map.h"
 
 #define EQ_VERTEX_DIST 0.00001
@@ -1297,16 +1298,7 @@ void SurfaceTool::optimize_indices_for_cache() {
 AABB SurfaceTool::get_aabb() const {
 	ERR_FAIL_COND_V(vertex_array.is_empty(), AABB());
 
-	AABB aabb;
-	for (uint32_t i = 0; i < vertex_array.size(); i++) {
-		if (i == 0) {
-			aabb.position = vertex_array[i].vertex;
-		} else {
-			aabb.expand_to(vertex_array[i].vertex);
-		}
-	}
-
-	return aabb;
+	return Vector3Batch::get_aabb(&vertex_array[0].vertex, vertex_array.size(), sizeof(Vertex));
 }
 Vector<int> SurfaceTool::generate_lod(float p_threshold, int p_target_index_count) {
 	WARN_DEPRECATED_MSG(R"*(The "SurfaceTool.generate_lod()" method is deprecated. Consider using "ImporterMesh.generate_lods()" instead.)*");
@@ -32,6 +32,7 @@
 #include "rendering_server.compat.inc"
 
 #include "core/config/project_settings.h"
+#include "core/math/vector3_batch.h"
 #include "core/variant/typed_array.h"
 #include "servers/rendering/shader_language.h"
 #include "servers/rendering/shader_warnings.h"
@@ -345,22 +346,6 @@ void _get_tbn_from_axis_angle(const Vector3 &p_axis, float p_angle, Vector3 &r_n
 	r_normal = tbn.rows[2];
 }
 
-AABB _compute_aabb_from_points(const Vector3 *p_data, int p_length) {
-	if (p_length == 0) {
-		return AABB();
-	}
-
-	Vector3 min = p_data[0];
-	Vector3 max = p_data[0];
-
-	for (int i = 1; i < p_length; ++i) {
-		min = min.min(p_data[i]);
-		max = max.max(p_data[i]);
-	}
-
-	return AABB(min, max - min);
-}
-
 Error RenderingServer::_surface_set_data(Array p_arrays, uint64_t p_format, uint32_t *p_offsets, uint32_t p_vertex_stride, uint32_t p_normal_stride, uint32_t p_attrib_stride, uint32_t p_skin_stride, Vector<uint8_t> &r_vertex_array, Vector<uint8_t> &r_attrib_array, Vector<uint8_t> &r_skin_array, int p_vertex_array_len, Vector<uint8_t> &r_index_array, int p_index_array_len, AABB &r_aabb, Vector<AABB> &r_bone_aabb, Vector4 &r_uv_scale) {
 	uint8_t *vw = r_vertex_array.ptrw();
 	uint8_t *aw = r_attrib_array.ptrw();
@@ -454,7 +439,7 @@ Error RenderingServer::_surface_set_data(Array p_arrays, uint64_t p_format, uint
 
 					const Vector3 *src = array.ptr();
 
-					r_aabb = _compute_aabb_from_points(src, p_vertex_array_len);
+					r_aabb = Vector3Batch::get_aabb(src, p_vertex_array_len);
 					r_aabb.size = r_aabb.size.max(SMALL_VEC3);
 
 					if (p_format & ARRAY_FLAG_COMPRESS_ATTRIBUTES) {
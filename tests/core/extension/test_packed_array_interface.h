@@ -0,0 +1,173 @@
+/**************************************************************************/
+/*  test_packed_array_interface.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/extension/gdextension.h"
+#include "core/object/method_bind.h"
+#include "core/os/memory.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPackedArrayInterface {
+
+// Large enough that any duplication of the data shows in the memory usage.
+static const int64_t BUFFER_SIZE = 1 << 20;
+
+static PackedByteArray make_buffer() {
+	PackedByteArray buffer;
+	buffer.resize(BUFFER_SIZE);
+	buffer.fill(7);
+	return buffer;
+}
+
+// Memory grown by more than a buffer means its data was duplicated.
+#define CHECK_NO_DUPLICATION(m_usage_before) CHECK(Memory::get_mem_usage() < (m_usage_before) + BUFFER_SIZE)
+
+TEST_CASE("[PackedArray][GDExtension] Read spans borrow the data") {
+	GDExtensionInterfacePackedArrayGetReadSpan get_read_span = (GDExtensionInterfacePackedArrayGetReadSpan)GDExtension::get_interface_function("packed_array_get_read_span");
+	REQUIRE(get_read_span != nullptr);
+
+	const PackedByteArray buffer = make_buffer();
+	const PackedByteArray shared = buffer;
+	const uint64_t usage = Memory::get_mem_usage();
+
+	GDExtensionInt size = 0;
+	const uint8_t *span = (const uint8_t *)get_read_span(GDEXTENSION_VARIANT_TYPE_PACKED_BYTE_ARRAY, &shared, &size);
+	CHECK(span == buffer.ptr());
+	CHECK(size == BUFFER_SIZE);
+	CHECK(span[BUFFER_SIZE - 1] == 7);
+	CHECK_NO_DUPLICATION(usage);
+
+	const PackedVector3Array empty;
+	size = -1;
+	CHECK(get_read_span(GDEXTENSION_VARIANT_TYPE_PACKED_VECTOR3_ARRAY, &empty, &size) == nullptr);
+	CHECK(size == 0);
+
+	ERR_PRINT_OFF;
+	const Array array;
+	size = -1;
+	CHECK(get_read_span(GDEXTENSION_VARIANT_TYPE_ARRAY, &array, &size) == nullptr);
+	CHECK(size == 0);
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[PackedArray][GDExtension] Write spans duplicate shared data once") {
+	GDExtensionInterfacePackedArrayGetWriteSpan get_write_span = (GDExtensionInterfacePackedArrayGetWriteSpan)GDExtension::get_interface_function("packed_array_get_write_span");
+	REQUIRE(get_write_span != nullptr);
+
+	PackedByteArray buffer = make_buffer();
+	const uint8_t *data = buffer.ptr();
+	GDExtensionInt size = 0;
+
+	SUBCASE("Exclusively owned data is written in place") {
+		const uint64_t usage = Memory::get_mem_usage();
+		uint8_t *span = (uint8_t *)get_write_span(GDEXTENSION_VARIANT_TYPE_PACKED_BYTE_ARRAY, &buffer, &size);
+		CHECK(span == data);
+		CHECK(size == BUFFER_SIZE);
+		CHECK_NO_DUPLICATION(usage);
+	}
+
+	SUBCASE("Shared data is duplicated") {
+		PackedByteArray shared = buffer;
+		uint8_t *span = (uint8_t *)get_write_span(GDEXTENSION_VARIANT_TYPE_PACKED_BYTE_ARRAY, &shared, &size);
+		CHECK(span != data);
+		span[0] = 1;
+		CHECK(buffer[0] == 7);
+
+		const uint64_t usage = Memory::get_mem_usage();
+		CHECK(get_write_span(GDEXTENSION_VARIANT_TYPE_PACKED_BYTE_ARRAY, &shared, &size) == span);
+		CHECK_NO_DUPLICATION(usage);
+	}
+}
+
+TEST_CASE("[PackedArray][GDExtension] Moving transfers ownership") {
+	GDExtensionInterfacePackedArrayMove move = (GDExtensionInterfacePackedArrayMove)GDExtension::get_interface_function("packed_array_move");
+	GDExtensionInterfacePackedArrayGetWriteSpan get_write_span = (GDExtensionInterfacePackedArrayGetWriteSpan)GDExtension::get_interface_function("packed_array_get_write_span");
+	REQUIRE(move != nullptr);
+	REQUIRE(get_write_span != nullptr);
+
+	PackedByteArray buffer = make_buffer();
+	const uint8_t *data = buffer.ptr();
+	const uint64_t usage = Memory::get_mem_usage();
+
+	alignas(PackedByteArray) uint8_t storage[sizeof(PackedByteArray)];
+	move(GDEXTENSION_VARIANT_TYPE_PACKED_BYTE_ARRAY, storage, &buffer);
+	PackedByteArray *moved = (PackedByteArray *)storage;
+
+	CHECK(buffer.is_empty());
+	CHECK(moved->ptr() == data);
+	CHECK(moved->size() == BUFFER_SIZE);
+
+	// The moved array is the only owner, so writing to it doesn't duplicate the data.
+	GDExtensionInt size = 0;
+	CHECK(get_write_span(GDEXTENSION_VARIANT_TYPE_PACKED_BYTE_ARRAY, moved, &size) == data);
+	CHECK_NO_DUPLICATION(usage);
+
+	moved->~PackedByteArray();
+}
+
+class PackedArrayProvider : public Object {
+	GDSOFTCLASS(PackedArrayProvider, Object);
+
+public:
+	const float *data = nullptr;
+
+	PackedFloat32Array make_array(int64_t p_size) {
+		PackedFloat32Array array;
+		array.resize(p_size);
+		data = array.ptr();
+		return array;
+	}
+};
+
+TEST_CASE("[PackedArray][GDExtension] Ptrcall returns exclusively owned arrays") {
+	PackedArrayProvider *provider = memnew(PackedArrayProvider);
+	MethodBind *method = create_method_bind(&PackedArrayProvider::make_array);
+
+	const int64_t size = BUFFER_SIZE / sizeof(float);
+	const void *args[1] = { &size };
+	PackedFloat32Array result;
+	method->ptrcall(provider, args, &result);
+
+	CHECK(result.ptr() == provider->data);
+	CHECK(result.size() == size);
+
+	const uint64_t usage = Memory::get_mem_usage();
+	CHECK(result.ptrw() == provider->data);
+	CHECK_NO_DUPLICATION(usage);
+
+	memdelete(method);
+	memdelete(provider);
+}
+
+#undef CHECK_NO_DUPLICATION
+
+} // namespace TestPackedArrayInterface
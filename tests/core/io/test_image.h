@@ -31,8 +31,10 @@
 #pragma once
 
 #include "core/io/image.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
+#include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
 #include "modules/modules_enabled.gen.h"
@@ -470,4 +472,35 @@ TEST_CASE("[Image] Convert image") {
 	CHECK_MESSAGE(image2->get_data() == image_data, "Image conversion to invalid type (Image::FORMAT_MAX + 1) should not alter image.");
 }
 
+// Resizing and mipmap generation are split across the WorkerThreadPool, compare with the thread count reported.
+TEST_CASE_BENCHMARK("[Image][Benchmark] Resize and generate mipmaps") {
+	static constexpr int ITERATIONS = 10;
+	static constexpr Image::Interpolation INTERPOLATIONS[] = { Image::INTERPOLATE_NEAREST, Image::INTERPOLATE_BILINEAR, Image::INTERPOLATE_CUBIC, Image::INTERPOLATE_LANCZOS };
+	static constexpr const char *INTERPOLATION_NAMES[] = { "nearest", "bilinear", "cubic", "Lanczos" };
+
+	Ref<Image> source = Image::create_empty(2048, 2048, false, Image::FORMAT_RGBA8);
+	for (int y = 0; y < source->get_height(); y += 16) {
+		for (int x = 0; x < source->get_width(); x += 16) {
+			source->set_pixel(x, y, Color(x / 2048.0, y / 2048.0, 0.5));
+		}
+	}
+
+	for (int i = 0; i < 4; i++) {
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int it = 0; it < ITERATIONS; it++) {
+			Ref<Image> image = source->duplicate();
+			image->resize(3000, 1500, INTERPOLATIONS[i]);
+			CHECK(image->get_width() == 3000);
+		}
+		MESSAGE(vformat("Resize with %s interpolation: %d us.", INTERPOLATION_NAMES[i], (OS::get_singleton()->get_ticks_usec() - begin) / ITERATIONS));
+	}
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int it = 0; it < ITERATIONS; it++) {
+		Ref<Image> image = source->duplicate();
+		CHECK(image->generate_mipmaps() == OK);
+	}
+	MESSAGE(vformat("Generate mipmaps: %d us, %d threads.", (OS::get_singleton()->get_ticks_usec() - begin) / ITERATIONS, WorkerThreadPool::get_singleton()->get_thread_count()));
+}
+
 } // namespace TestImage
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/json.h"
+#include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -283,6 +284,13 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 				vformat("Parsing valid unicode escape sequence with value `0020` as JSON should return the expected value."));
 	}
 
+	SUBCASE("Escape sequences between plain characters") {
+		json.parse(R"("ab\ncd\u00e9f\"\"")");
+
+		CHECK(json.get_error_line() == 0);
+		CHECK(String(json.get_data()) == String::utf8("ab\ncd\xc3\xa9" "f\"\""));
+	}
+
 	SUBCASE("Invalid escape sequences") {
 		ERR_PRINT_OFF
 		for (char32_t i = 0; i < 128; i++) {
@@ -317,6 +325,20 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 	}
 }
 
+TEST_CASE("[JSON] Parsed objects share their keys") {
+	JSON json;
+	json.parse(R"([{"id": 1, "name": "a"}, {"name": "b", "id": 2}, {"nested": {"id": 3}}])");
+
+	const Array array = json.get_data();
+	const Dictionary first = array[0];
+	const Dictionary second = array[1];
+	const Dictionary nested = Dictionary(array[2])["nested"];
+	CHECK(int(second["id"]) == 2);
+	CHECK(String(first.get_key_at_index(0)).ptr() == String(second.get_key_at_index(1)).ptr());
+	CHECK(String(first.get_key_at_index(0)).ptr() == String(nested.get_key_at_index(0)).ptr());
+	CHECK(String(first.get_key_at_index(1)).ptr() == String(second.get_key_at_index(0)).ptr());
+}
+
 TEST_CASE("[JSON] Serialization") {
 	JSON json;
 
@@ -401,4 +423,24 @@ TEST_CASE("[JSON] Serialization") {
 		}
 	}
 }
+
+// Parsing a large JSON array of small objects.
+TEST_CASE_BENCHMARK("[JSON][Benchmark] Parsing objects") {
+	const int count = 20000;
+	String json_string = "[";
+	for (int i = 0; i < count; i++) {
+		json_string += vformat(R"({"id": %d, "type": "event", "name": "entity_%d", "position": [%d, %d], "tags": ["a", "b"]},)", i, i, i, -i);
+	}
+	json_string += "{}]";
+
+	JSON json;
+	const uint64_t mem_before = Memory::get_mem_usage();
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	const Error err = json.parse(json_string);
+	const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(err == OK);
+	CHECK(Array(json.get_data()).size() == count + 1);
+	MESSAGE(vformat("Parsed %d objects (%d characters) in %d usec, %d bytes retained.", count, json_string.length(), elapsed, Memory::get_mem_usage() - mem_before));
+}
+
 } // namespace TestJSON
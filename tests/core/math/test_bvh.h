@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*  test_bvh.h                                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/bvh.h"
+#include "core/math/random_pcg.h"
+
+#include "tests/test_macros.h"
+
+namespace TestBVH {
+
+struct TestItem {
+	int id = 0;
+};
+
+class TestPairTestFunction {
+public:
+	static bool user_pair_check(const TestItem *p_a, const TestItem *p_b) {
+		return true;
+	}
+};
+
+class TestCullTestFunction {
+public:
+	static bool user_cull_check(const TestItem *p_a, const TestItem *p_b) {
+		return true;
+	}
+};
+
+typedef BVH_Manager<TestItem, 2, true, 128, TestPairTestFunction, TestCullTestFunction> TestPairingBVH;
+
+// Pairs are logged as (1, a, b) and unpairs as (0, a, b).
+static void *_log_pair(void *p_self, uint32_t p_id_a, TestItem *p_a, int p_subindex_a, uint32_t p_id_b, TestItem *p_b, int p_subindex_b) {
+	static_cast<LocalVector<Vector3i> *>(p_self)->push_back(Vector3i(1, p_a->id, p_b->id));
+	return nullptr;
+}
+
+static void _log_unpair(void *p_self, uint32_t p_id_a, TestItem *p_a, int p_subindex_a, uint32_t p_id_b, TestItem *p_b, int p_subindex_b, void *p_pair_data) {
+	static_cast<LocalVector<Vector3i> *>(p_self)->push_back(Vector3i(0, p_a->id, p_b->id));
+}
+
+static AABB random_box(RandomPCG &p_rng) {
+	return AABB(Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()) * 40.0, Vector3(2, 2, 2));
+}
+
+TEST_CASE("[BVH] Parallel pairing matches serial pairing") {
+	const int item_count = 500;
+	LocalVector<TestItem> items;
+	items.resize(item_count);
+	for (int i = 0; i < item_count; i++) {
+		items[i].id = i;
+	}
+
+	TestPairingBVH serial_bvh;
+	TestPairingBVH parallel_bvh;
+	parallel_bvh.params_set_parallel_pairing(true);
+
+	LocalVector<Vector3i> serial_log;
+	LocalVector<Vector3i> parallel_log;
+	serial_bvh.set_pair_callback(_log_pair, &serial_log);
+	serial_bvh.set_unpair_callback(_log_unpair, &serial_log);
+	parallel_bvh.set_pair_callback(_log_pair, &parallel_log);
+	parallel_bvh.set_unpair_callback(_log_unpair, &parallel_log);
+
+	LocalVector<BVHHandle> serial_handles;
+	LocalVector<BVHHandle> parallel_handles;
+	RandomPCG rng(42);
+	for (int i = 0; i < item_count; i++) {
+		const AABB aabb = random_box(rng);
+		serial_handles.push_back(serial_bvh.create(&items[i], true, 0, 1, aabb));
+		parallel_handles.push_back(parallel_bvh.create(&items[i], true, 0, 1, aabb));
+	}
+
+	// Move every item each step, so the pair search covers enough items to run in parallel.
+	for (int step = 0; step < 4; step++) {
+		for (int i = 0; i < item_count; i++) {
+			const AABB aabb = random_box(rng);
+			serial_bvh.move(serial_handles[i], aabb);
+			parallel_bvh.move(parallel_handles[i], aabb);
+		}
+		serial_bvh.update();
+		parallel_bvh.update();
+	}
+
+	CHECK_MESSAGE(serial_log.size() > 0, "Moving items around should pair and unpair them.");
+	REQUIRE(parallel_log.size() == serial_log.size());
+
+	bool same_order = true;
+	for (uint32_t i = 0; i < serial_log.size(); i++) {
+		same_order = same_order && parallel_log[i] == serial_log[i];
+	}
+	CHECK_MESSAGE(same_order, "Callbacks should be sent in the same order when pairing in parallel.");
+
+	for (int i = 0; i < item_count; i++) {
+		serial_bvh.erase(serial_handles[i]);
+		parallel_bvh.erase(parallel_handles[i]);
+	}
+}
+
+} // namespace TestBVH
@@ -31,6 +31,8 @@
 #pragma once
 
 #include "core/math/triangle_mesh.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 #include "scene/resources/3d/primitive_meshes.h"
 
 #include "tests/test_macros.h"
@@ -79,4 +81,34 @@ TEST_CASE("[SceneTree][TriangleMesh] BVH creation and intersection") {
 		CHECK(face_index == 8);
 	}
 }
+
+// TriangleMesh::create() computes the per face data on the WorkerThreadPool.
+TEST_CASE_BENCHMARK("[SceneTree][TriangleMesh][Benchmark] Create from a dense sphere") {
+	static constexpr int ITERATIONS = 20;
+
+	Ref<SphereMesh> sphere_mesh;
+	sphere_mesh.instantiate();
+	sphere_mesh->set_radial_segments(512);
+	sphere_mesh->set_rings(256);
+	const Vector<Face3> faces = sphere_mesh->get_faces();
+
+	Vector<Vector3> vertices;
+	vertices.resize(faces.size() * 3);
+	Vector3 *vertices_ptr = vertices.ptrw();
+	for (int i = 0; i < faces.size(); i++) {
+		for (int j = 0; j < 3; j++) {
+			vertices_ptr[i * 3 + j] = faces[i].vertex[j];
+		}
+	}
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int it = 0; it < ITERATIONS; it++) {
+		Ref<TriangleMesh> triangle_mesh;
+		triangle_mesh.instantiate();
+		triangle_mesh->create(vertices);
+		CHECK(triangle_mesh->is_valid());
+	}
+	MESSAGE(vformat("%d faces: %d us per create(), %d threads.", faces.size(), (OS::get_singleton()->get_ticks_usec() - begin) / ITERATIONS, WorkerThreadPool::get_singleton()->get_thread_count()));
+}
+
 } // namespace TestTriangleMesh
@@ -0,0 +1,227 @@
+/**************************************************************************/
+/*  test_vector3_batch.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/random_number_generator.h"
+#include "core/math/transform_3d.h"
+#include "core/math/vector3_batch.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace TestVector3Batch {
+
+static LocalVector<Vector3> make_points(uint32_t p_count, uint64_t p_seed) {
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(p_seed);
+	LocalVector<Vector3> points;
+	for (uint32_t i = 0; i < p_count; i++) {
+		points.push_back(Vector3(rng->randf_range(-100, 100), rng->randf_range(-100, 100), rng->randf_range(-100, 100)));
+	}
+	return points;
+}
+
+// Sizes cover the vectorized part, the scalar remainder and both at once.
+static const uint32_t SIZES[] = { 0, 1, 3, 4, 5, 8, 11, 64, 67 };
+
+TEST_CASE("[Vector3Batch] Transform matches Transform3D::xform()") {
+	const Transform3D xform(Basis(Vector3(1, 2, 3).normalized(), 0.7).scaled(Vector3(2, 0.5, 3)), Vector3(-4, 5, 6));
+	for (uint32_t size : SIZES) {
+		const LocalVector<Vector3> points = make_points(size, size);
+		LocalVector<Vector3> result;
+		result.resize(size);
+		Vector3Batch::transform(xform, points.ptr(), result.ptr(), size);
+		for (uint32_t i = 0; i < size; i++) {
+			CHECK(result[i] == xform.xform(points[i]));
+		}
+
+		Vector3Batch::transform(xform.basis, points.ptr(), result.ptr(), size);
+		for (uint32_t i = 0; i < size; i++) {
+			CHECK(result[i] == xform.basis.xform(points[i]));
+		}
+	}
+
+	Vector<Vector3> packed;
+	packed.push_back(Vector3(1, 2, 3));
+	packed.push_back(Vector3(-1, 0, 1));
+	const Vector<Vector3> transformed = xform.xform(packed);
+	REQUIRE(transformed.size() == 2);
+	CHECK(transformed[0] == xform.xform(packed[0]));
+	CHECK(transformed[1] == xform.xform(packed[1]));
+}
+
+TEST_CASE("[Vector3Batch] Normalize, dot and cross match Vector3") {
+	for (uint32_t size : SIZES) {
+		LocalVector<Vector3> a = make_points(size, size);
+		const LocalVector<Vector3> b = make_points(size, size + 100);
+		if (size > 2) {
+			a[2] = Vector3(); // Zero length vectors normalize to zero.
+		}
+
+		LocalVector<Vector3> vectors;
+		vectors.resize(size);
+		LocalVector<real_t> scalars;
+		scalars.resize(size);
+
+		Vector3Batch::normalize(a.ptr(), vectors.ptr(), size);
+		for (uint32_t i = 0; i < size; i++) {
+			CHECK(vectors[i] == a[i].normalized());
+		}
+
+		Vector3Batch::dot(a.ptr(), b.ptr(), scalars.ptr(), size);
+		for (uint32_t i = 0; i < size; i++) {
+			CHECK(scalars[i] == a[i].dot(b[i]));
+		}
+
+		Vector3Batch::cross(a.ptr(), b.ptr(), vectors.ptr(), size);
+		for (uint32_t i = 0; i < size; i++) {
+			CHECK(vectors[i] == a[i].cross(b[i]));
+		}
+
+		// In place.
+		Vector3Batch::normalize(a.ptr(), a.ptr(), size);
+		for (uint32_t i = 0; i < size; i++) {
+			CHECK((a[i].is_zero_approx() || a[i].is_normalized()));
+		}
+	}
+}
+
+TEST_CASE("[Vector3Batch] AABB of points") {
+	CHECK(Vector3Batch::get_aabb(nullptr, 0) == AABB());
+
+	const Vector3 single(1, -2, 3);
+	CHECK(Vector3Batch::get_aabb(&single, 1) == AABB(single, Vector3()));
+
+	for (uint32_t size : SIZES) {
+		if (size == 0) {
+			continue;
+		}
+		const LocalVector<Vector3> points = make_points(size, size);
+		Vector3 begin = points[0];
+		Vector3 end = points[0];
+		for (const Vector3 &point : points) {
+			begin = begin.min(point);
+			end = end.max(point);
+		}
+		CHECK(Vector3Batch::get_aabb(points.ptr(), size) == AABB(begin, end - begin));
+	}
+
+	struct Vertex {
+		Vector3 position;
+		Vector3 normal;
+	};
+	const Vertex vertices[3] = {
+		{ Vector3(1, 2, 3), Vector3(100, 100, 100) },
+		{ Vector3(-1, 5, 0), Vector3(-100, -100, -100) },
+		{ Vector3(0, 0, 4), Vector3() },
+	};
+	CHECK(Vector3Batch::get_aabb(&vertices[0].position, 3, sizeof(Vertex)) == AABB(Vector3(-1, 0, 0), Vector3(2, 5, 4)));
+}
+
+TEST_CASE("[Vector3Batch] PackedVector3Array methods") {
+	PackedVector3Array a;
+	a.push_back(Vector3(3, 0, 4));
+	a.push_back(Vector3(1, 2, 3));
+	PackedVector3Array b;
+	b.push_back(Vector3(0, 1, 0));
+	b.push_back(Vector3(-1, 0, 2));
+
+	const PackedVector3Array normalized = Variant(a).call("normalized");
+	REQUIRE(normalized.size() == 2);
+	CHECK(normalized[0] == a[0].normalized());
+	CHECK(normalized[1] == a[1].normalized());
+
+	const PackedFloat64Array dots = Variant(a).call("dot", b);
+	REQUIRE(dots.size() == 2);
+	CHECK(dots[0] == doctest::Approx(a[0].dot(b[0])));
+	CHECK(dots[1] == doctest::Approx(a[1].dot(b[1])));
+
+	const PackedVector3Array crosses = Variant(a).call("cross", b);
+	REQUIRE(crosses.size() == 2);
+	CHECK(crosses[0] == a[0].cross(b[0]));
+	CHECK(crosses[1] == a[1].cross(b[1]));
+
+	CHECK(AABB(Variant(a).call("get_aabb")) == AABB(Vector3(1, 0, 3), Vector3(2, 2, 1)));
+
+	b.push_back(Vector3());
+	ERR_PRINT_OFF;
+	CHECK(PackedVector3Array(Variant(a).call("cross", b)).is_empty());
+	ERR_PRINT_ON;
+}
+
+// Transforming a large point array with Vector3Batch and with a per element loop.
+TEST_CASE_BENCHMARK("[Vector3Batch][Benchmark] Batched and per element transform") {
+	static constexpr uint32_t POINT_COUNT = 1 << 16;
+	static constexpr uint32_t ITERATIONS = 200;
+
+	const Transform3D xform(Basis(Vector3(0, 1, 0), 0.3), Vector3(1, 2, 3));
+	const LocalVector<Vector3> points = make_points(POINT_COUNT, 0);
+	LocalVector<Vector3> result;
+	result.resize(POINT_COUNT);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (uint32_t it = 0; it < ITERATIONS; it++) {
+		for (uint32_t i = 0; i < POINT_COUNT; i++) {
+			result[i] = xform.xform(points[i]);
+		}
+	}
+	const uint64_t scalar_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (uint32_t it = 0; it < ITERATIONS; it++) {
+		Vector3Batch::transform(xform, points.ptr(), result.ptr(), POINT_COUNT);
+	}
+	const uint64_t batch_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	AABB aabb;
+	for (uint32_t it = 0; it < ITERATIONS; it++) {
+		aabb.position = points[0];
+		aabb.size = Vector3();
+		for (uint32_t i = 1; i < POINT_COUNT; i++) {
+			aabb.expand_to(points[i]);
+		}
+	}
+	const uint64_t expand_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (uint32_t it = 0; it < ITERATIONS; it++) {
+		aabb = Vector3Batch::get_aabb(points.ptr(), POINT_COUNT);
+	}
+	const uint64_t aabb_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("Transform: %d us per element, %d us batched.", scalar_usec, batch_usec));
+	MESSAGE(vformat("AABB: %d us with expand_to(), %d us batched.", expand_usec, aabb_usec));
+	CHECK(aabb.has_volume());
+}
+
+} // namespace TestVector3Batch
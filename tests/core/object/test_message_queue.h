@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+#pragma once
+
+#include "core/object/message_queue.h"
+#include "core/object/object.h"
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+class CounterObject : public Object {
+public:
+	int count = 0;
+	CallQueue *queue = nullptr;
+
+	void increment() {
+		count++;
+	}
+
+	void increment_and_requeue() {
+		count++;
+		if (count < 3) {
+			queue->push_callable_coalesced(callable_mp(this, &CounterObject::increment_and_requeue));
+		}
+	}
+};
+
+TEST_CASE("[MessageQueue] Coalesced calls") {
+	CallQueue queue;
+	CounterObject *object = memnew(CounterObject);
+	object->queue = &queue;
+
+	const Callable increment = callable_mp(object, &CounterObject::increment);
+	for (int i = 0; i < 5; i++) {
+		CHECK(queue.push_callable_coalesced(increment) == OK);
+	}
+	// Regular calls are never merged.
+	queue.push_callable(increment);
+
+	CHECK(queue.get_coalesced_message_count() == 4);
+	queue.flush();
+	CHECK(object->count == 2);
+
+	// Once flushed, the call can be queued again.
+	queue.push_callable_coalesced(increment);
+	queue.flush();
+	CHECK(object->count == 3);
+	CHECK(queue.get_coalesced_message_count() == 4);
+
+	SUBCASE("A coalesced call can queue itself again while it runs") {
+		object->count = 0;
+		queue.push_callable_coalesced(callable_mp(object, &CounterObject::increment_and_requeue));
+		// Calls queued during a flush run in the same flush.
+		queue.flush();
+		CHECK(object->count == 3);
+		CHECK(queue.get_coalesced_message_count() == 4);
+	}
+
+	memdelete(object);
+}
+
+TEST_CASE("[MessageQueue] Dropped messages are counted") {
+	CallQueue queue;
+	CounterObject *object = memnew(CounterObject);
+
+	queue.push_callable_coalesced(callable_mp(object, &CounterObject::increment));
+	queue.push_callable(callable_mp(object, &CounterObject::increment));
+	memdelete(object);
+
+	queue.flush();
+	CHECK(queue.get_dropped_message_count() == 2);
+	CHECK(queue.get_coalesced_message_count() == 0);
+}
+
+} // namespace TestMessageQueue
@@ -314,6 +314,29 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+class SignalReceiverObject : public Object {
+	GDCLASS(SignalReceiverObject, Object);
+
+public:
+	Object *emitter = nullptr;
+	SignalReceiverObject *other = nullptr;
+	int calls = 0;
+
+	void on_signal() {
+		calls++;
+	}
+
+	void on_signal_change_connections() {
+		calls++;
+		// Changes during an emission only take effect on the next one.
+		if (emitter->is_connected("my_custom_signal", callable_mp(other, &SignalReceiverObject::on_signal))) {
+			emitter->disconnect("my_custom_signal", callable_mp(other, &SignalReceiverObject::on_signal));
+		} else {
+			emitter->connect("my_custom_signal", callable_mp(other, &SignalReceiverObject::on_signal));
+		}
+	}
+};
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -431,6 +454,44 @@ TEST_CASE("[Object] Signals") {
 		SIGNAL_UNWATCH(&object, "my_custom_signal");
 	}
 
+	SUBCASE("Connecting or disconnecting during emission should only affect later emissions") {
+		SignalReceiverObject changer;
+		SignalReceiverObject receiver;
+		changer.emitter = &object;
+		changer.other = &receiver;
+
+		object.connect("my_custom_signal", callable_mp(&changer, &SignalReceiverObject::on_signal_change_connections));
+
+		// Connects the receiver, which must not be called yet.
+		object.emit_signal("my_custom_signal");
+		CHECK(changer.calls == 1);
+		CHECK(receiver.calls == 0);
+
+		// Disconnects the receiver, which must still be called for this emission.
+		object.emit_signal("my_custom_signal");
+		CHECK(changer.calls == 2);
+		CHECK(receiver.calls == 1);
+
+		object.emit_signal("my_custom_signal");
+		CHECK(changer.calls == 3);
+		CHECK(receiver.calls == 1);
+
+		object.disconnect("my_custom_signal", callable_mp(&changer, &SignalReceiverObject::on_signal_change_connections));
+		if (object.is_connected("my_custom_signal", callable_mp(&receiver, &SignalReceiverObject::on_signal))) {
+			object.disconnect("my_custom_signal", callable_mp(&receiver, &SignalReceiverObject::on_signal));
+		}
+	}
+
+	SUBCASE("One-shot connections should be called once") {
+		SignalReceiverObject receiver;
+		object.connect("my_custom_signal", callable_mp(&receiver, &SignalReceiverObject::on_signal), Object::CONNECT_ONE_SHOT);
+
+		object.emit_signal("my_custom_signal");
+		object.emit_signal("my_custom_signal");
+		CHECK(receiver.calls == 1);
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp(&receiver, &SignalReceiverObject::on_signal)));
+	}
+
 	SUBCASE("Connecting and then disconnecting many signals should not leave anything behind") {
 		List<Object::Connection> signal_connections;
 		Object targets[100];
@@ -0,0 +1,169 @@
+/**************************************************************************/
+/*  test_small_object_allocator.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/os.h"
+#include "core/os/small_object_allocator.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSmallObjectAllocator {
+
+// The allocator falls back to malloc() where it can't reserve its address range,
+// so ownership checks are conditional.
+
+TEST_CASE("[SmallObjectAllocator] Size classes") {
+	for (size_t size = 1; size <= SmallObjectAllocator::MAX_SIZE; size += 7) {
+		uint8_t *mem = (uint8_t *)SmallObjectAllocator::alloc(size);
+		REQUIRE(mem != nullptr);
+		memset(mem, 0xAB, size);
+		if (SmallObjectAllocator::owns(mem)) {
+			CHECK(SmallObjectAllocator::get_block_size(mem) >= size);
+			CHECK(SmallObjectAllocator::get_block_size(mem) < size + 128);
+		}
+		CHECK(mem[size - 1] == 0xAB);
+		SmallObjectAllocator::free(mem);
+	}
+
+	void *large = SmallObjectAllocator::alloc(SmallObjectAllocator::MAX_SIZE + 1);
+	CHECK_FALSE(SmallObjectAllocator::owns(large));
+	SmallObjectAllocator::free(large);
+
+	uint8_t *zeroed = (uint8_t *)SmallObjectAllocator::alloc_zeroed(100);
+	bool all_zero = true;
+	for (int i = 0; i < 100; i++) {
+		all_zero = all_zero && zeroed[i] == 0;
+	}
+	CHECK(all_zero);
+	SmallObjectAllocator::free(zeroed);
+}
+
+TEST_CASE("[SmallObjectAllocator] Freed blocks are reused") {
+	void *first = SmallObjectAllocator::alloc(40);
+	SmallObjectAllocator::free(first);
+	void *second = SmallObjectAllocator::alloc(48);
+	if (SmallObjectAllocator::owns(first)) {
+		CHECK(first == second);
+	}
+	SmallObjectAllocator::free(second);
+}
+
+TEST_CASE("[SmallObjectAllocator] Realloc keeps contents") {
+	uint8_t *mem = (uint8_t *)SmallObjectAllocator::alloc(10);
+	for (int i = 0; i < 10; i++) {
+		mem[i] = i;
+	}
+
+	// Growing within the size class keeps the block.
+	uint8_t *grown = (uint8_t *)SmallObjectAllocator::realloc(mem, 16);
+	if (SmallObjectAllocator::owns(mem)) {
+		CHECK(grown == mem);
+	}
+
+	// Growing past it, and past the pooled sizes, moves the contents.
+	for (size_t size : { size_t(100), size_t(400), size_t(4000) }) {
+		grown = (uint8_t *)SmallObjectAllocator::realloc(grown, size);
+		REQUIRE(grown != nullptr);
+		bool same = true;
+		for (int i = 0; i < 10; i++) {
+			same = same && grown[i] == i;
+		}
+		CHECK(same);
+	}
+	CHECK_FALSE(SmallObjectAllocator::owns(grown));
+	SmallObjectAllocator::free(grown);
+
+	// Reallocating a pooled block to zero bytes frees it.
+	void *small = SmallObjectAllocator::alloc(32);
+	if (SmallObjectAllocator::owns(small)) {
+		CHECK(SmallObjectAllocator::realloc(small, 0) == nullptr);
+	} else {
+		SmallObjectAllocator::free(small);
+	}
+}
+
+TEST_CASE("[SmallObjectAllocator] Blocks freed on other threads") {
+	const int count = 1000;
+	LocalVector<void *> blocks;
+	for (int i = 0; i < count; i++) {
+		blocks.push_back(SmallObjectAllocator::alloc(24));
+	}
+
+	// The other thread caches the blocks and returns them to the global pool when it exits.
+	Thread thread;
+	thread.start([](void *p_userdata) {
+		LocalVector<void *> *to_free = static_cast<LocalVector<void *> *>(p_userdata);
+		for (void *block : *to_free) {
+			SmallObjectAllocator::free(block);
+		}
+	},
+			&blocks);
+	thread.wait_to_finish();
+
+	const SmallObjectAllocator::Stats stats = SmallObjectAllocator::get_stats();
+	CHECK(stats.pooled_bytes <= stats.committed_bytes);
+	CHECK(stats.live_bytes <= stats.pooled_bytes);
+	CHECK(SmallObjectAllocator::get_fragmentation() >= 0.0);
+	CHECK(SmallObjectAllocator::get_fragmentation() <= 1.0);
+}
+
+// Allocating and freeing batches of small blocks with and without the small object allocator.
+TEST_CASE_BENCHMARK("[SmallObjectAllocator][Benchmark] Allocation throughput") {
+	const int iterations = 200000;
+	const int batch = 64;
+	void *blocks[batch];
+
+	// Sizes typical of CowData headers, List elements and StringName data.
+	auto run = [&](void *(*p_alloc)(size_t), void (*p_free)(void *)) {
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < iterations; i++) {
+			for (int j = 0; j < batch; j++) {
+				blocks[j] = p_alloc(16 + ((i + j) & 15) * 24);
+			}
+			for (int j = 0; j < batch; j += 2) {
+				p_free(blocks[j]);
+			}
+			for (int j = 1; j < batch; j += 2) {
+				p_free(blocks[j]);
+			}
+		}
+		return OS::get_singleton()->get_ticks_usec() - begin;
+	};
+
+	const uint64_t malloc_usec = run([](size_t p_size) { return malloc(p_size); }, [](void *p_mem) { free(p_mem); });
+	const uint64_t pool_usec = run(SmallObjectAllocator::alloc, SmallObjectAllocator::free);
+	const uint64_t static_usec = run([](size_t p_size) { return Memory::alloc_static(p_size); }, [](void *p_mem) { Memory::free_static(p_mem); });
+	MESSAGE(vformat("%d allocations: malloc %d usec, SmallObjectAllocator %d usec, Memory::alloc_static %d usec.", iterations * batch, malloc_usec, pool_usec, static_usec));
+	MESSAGE(vformat("Static memory: %d bytes in use, fragmentation %.2f.", OS::get_singleton()->get_static_memory_usage(), OS::get_singleton()->get_static_memory_fragmentation()));
+}
+
+} // namespace TestSmallObjectAllocator
@@ -0,0 +1,164 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const StringName a = "string_name_interning";
+	const StringName b = String("string_name_interning");
+	const StringName c = "string_name_interning_other";
+
+	CHECK(a == b);
+	CHECK(a.data_unique_pointer() == b.data_unique_pointer());
+	CHECK(a != c);
+	CHECK(a == "string_name_interning");
+	CHECK(a.hash() == String("string_name_interning").hash());
+	CHECK(StringName("").is_empty());
+	CHECK(StringName(String()).is_empty());
+}
+
+#ifdef THREADS_ENABLED
+// Many threads creating, copying and releasing the same and distinct names at once.
+// Names that are alive on the main thread must keep their identity, and names that
+// only live on worker threads must still be interned once per lifetime.
+TEST_CASE("[StringName] Thread safety") {
+	struct StringNameTester {
+		const int name_count = 512;
+		const int iterations = 20;
+
+		LocalVector<String> names;
+		LocalVector<StringName> pinned;
+		TightLocalVector<Thread> threads;
+		SafeNumeric<uint32_t> next_thread_idx;
+		SafeNumeric<uint32_t> failures;
+
+		StringNameTester() {
+			for (int i = 0; i < name_count; i++) {
+				names.push_back("stress_name_" + itos(i));
+				// Keep every other name alive for the whole test.
+				if (i % 2 == 0) {
+					pinned.push_back(StringName(names[i]));
+				}
+			}
+			threads.resize(MAX(2, OS::get_singleton()->get_processor_count()));
+		}
+
+		void test() {
+			for (uint32_t i = 0; i < threads.size(); i++) {
+				threads[i].start(
+						[](void *p_data) {
+							StringNameTester *tester = (StringNameTester *)p_data;
+							const uint32_t self_idx = tester->next_thread_idx.postincrement();
+
+							for (int it = 0; it < tester->iterations; it++) {
+								for (int i = 0; i < tester->name_count; i++) {
+									// Walk the names in a different order on each thread.
+									const int idx = (i * 7 + self_idx * 13 + it) % tester->name_count;
+									const StringName from_string = tester->names[idx];
+									const StringName from_cstr = tester->names[idx].utf8().get_data();
+									StringName copy = from_string;
+
+									if (from_string != from_cstr || copy != from_string || from_string != tester->names[idx]) {
+										tester->failures.increment();
+									}
+									if (idx % 2 == 0 && from_string != tester->pinned[idx / 2]) {
+										tester->failures.increment();
+									}
+								}
+							}
+						},
+						this);
+			}
+
+			for (uint32_t i = 0; i < threads.size(); i++) {
+				threads[i].wait_to_finish();
+			}
+
+			CHECK_EQ(failures.get(), 0u);
+		}
+	};
+
+	StringNameTester tester;
+	tester.test();
+}
+
+// Interning the same set of names from several threads at once.
+TEST_CASE_BENCHMARK("[StringName][Benchmark] Concurrent interning throughput") {
+	static constexpr int NAME_COUNT = 4096;
+	static constexpr int ITERATIONS = 100;
+
+	LocalVector<String> names;
+	for (int i = 0; i < NAME_COUNT; i++) {
+		names.push_back("benchmark_name_" + itos(i));
+	}
+	// Existing names, so the benchmark measures lookups rather than insertions.
+	LocalVector<StringName> pinned;
+	for (const String &name : names) {
+		pinned.push_back(name);
+	}
+
+	for (uint32_t thread_count = 1; thread_count <= (uint32_t)OS::get_singleton()->get_processor_count(); thread_count *= 2) {
+		TightLocalVector<Thread> threads;
+		threads.resize(thread_count);
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (uint32_t i = 0; i < thread_count; i++) {
+			threads[i].start(
+					[](void *p_data) {
+						const LocalVector<String> &thread_names = *(const LocalVector<String> *)p_data;
+						for (int it = 0; it < ITERATIONS; it++) {
+							for (const String &name : thread_names) {
+								const StringName sname = name;
+							}
+						}
+					},
+					&names);
+		}
+		for (uint32_t i = 0; i < thread_count; i++) {
+			threads[i].wait_to_finish();
+		}
+		const uint64_t elapsed = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+
+		const double lookups_per_second = double(thread_count) * NAME_COUNT * ITERATIONS * 1000000.0 / elapsed;
+		MESSAGE(vformat("%d thread(s): %d us, %.1f M lookups/s.", thread_count, elapsed, lookups_per_second / 1000000.0));
+	}
+}
+#endif // THREADS_ENABLED
+
+} // namespace TestStringName
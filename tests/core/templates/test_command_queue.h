@@ -560,4 +560,102 @@ TEST_CASE("[CommandQueue] Test Parameter Passing Semantics") {
 
 	sts.destroy_threads();
 }
+
+struct MultiProducerState {
+	static constexpr int PRODUCER_MAX = 64;
+
+	CommandQueueMT command_queue;
+	TightLocalVector<Thread> producers;
+	Thread consumer;
+	SafeFlag exit_consumer;
+	SafeNumeric<int> next_producer;
+	SafeNumeric<int> sync_errors;
+	int commands_per_producer = 0;
+
+	int last[PRODUCER_MAX];
+	int order_errors = 0;
+	int command_count = 0;
+
+	void command(int p_producer, int p_index) {
+		if (last[p_producer] + 1 != p_index) {
+			order_errors++;
+		}
+		last[p_producer] = p_index;
+		command_count++;
+	}
+
+	int command_ret(int p_value) {
+		return p_value * 2;
+	}
+
+	// Returns the elapsed time in microseconds.
+	uint64_t run(int p_producer_count, int p_commands_per_producer) {
+		commands_per_producer = p_commands_per_producer;
+		for (int &l : last) {
+			l = -1;
+		}
+
+		consumer.start(
+				[](void *p_data) {
+					MultiProducerState *mps = (MultiProducerState *)p_data;
+					while (!mps->exit_consumer.is_set()) {
+						mps->command_queue.flush_if_pending();
+					}
+					mps->command_queue.flush_all();
+				},
+				this);
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		producers.resize(p_producer_count);
+		for (uint32_t i = 0; i < producers.size(); i++) {
+			producers[i].start(
+					[](void *p_data) {
+						MultiProducerState *mps = (MultiProducerState *)p_data;
+						const int producer = mps->next_producer.postincrement();
+						for (int j = 0; j < mps->commands_per_producer; j++) {
+							mps->command_queue.push(mps, &MultiProducerState::command, producer, j);
+							if (j % 1024 == 0) {
+								int ret = 0;
+								mps->command_queue.push_and_ret(mps, &MultiProducerState::command_ret, &ret, j);
+								if (ret != j * 2) {
+									mps->sync_errors.increment();
+								}
+							}
+						}
+					},
+					this);
+		}
+		for (uint32_t i = 0; i < producers.size(); i++) {
+			producers[i].wait_to_finish();
+		}
+		command_queue.sync();
+		const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+		exit_consumer.set();
+		consumer.wait_to_finish();
+		return elapsed;
+	}
+};
+
+TEST_CASE("[CommandQueue] Multiple producers keep their order") {
+	MultiProducerState mps;
+	const int producer_count = 8;
+	mps.run(producer_count, 5000);
+
+	CHECK(mps.command_count == producer_count * 5000);
+	CHECK(mps.order_errors == 0);
+	CHECK(mps.sync_errors.get() == 0);
+}
+
+// Commands per second with an increasing number of producer threads.
+TEST_CASE_BENCHMARK("[CommandQueue][Benchmark] Multiple producers") {
+	const int commands_per_producer = 200000;
+	for (int producer_count = 1; producer_count <= MultiProducerState::PRODUCER_MAX; producer_count *= 2) {
+		MultiProducerState mps;
+		const uint64_t elapsed = MAX(mps.run(producer_count, commands_per_producer), 1u);
+		CHECK(mps.order_errors == 0);
+		const double commands_per_second = double(producer_count) * commands_per_producer * 1000000.0 / elapsed;
+		MESSAGE(vformat("%d producer(s): %d us, %.1f M commands/s.", producer_count, elapsed, commands_per_second / 1000000.0));
+	}
+}
 } // namespace TestCommandQueue
@@ -0,0 +1,258 @@
+/**************************************************************************/
+/*  test_group_hash_map.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/os.h"
+#include "core/templates/a_hash_map.h"
+#include "core/templates/group_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGroupHashMap {
+
+TEST_CASE("[GroupHashMap] List initialization") {
+	GroupHashMap<int, String> map{ { 0, "A" }, { 1, "B" }, { 2, "C" }, { 3, "D" }, { 4, "E" } };
+
+	CHECK(map.size() == 5);
+	CHECK(map[0] == "A");
+	CHECK(map[1] == "B");
+	CHECK(map[2] == "C");
+	CHECK(map[3] == "D");
+	CHECK(map[4] == "E");
+}
+
+TEST_CASE("[GroupHashMap] Insert, overwrite and erase") {
+	GroupHashMap<int, int> map;
+	GroupHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+
+	map.insert(42, 1234);
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+
+	map.remove(map.find(42));
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(!map.erase(42));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[GroupHashMap] Iteration keeps insertion order") {
+	GroupHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.insert(123, 111111);
+	map.erase(0);
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(123, 111111));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == 3);
+
+	const GroupHashMap<int, int> const_map = map;
+	idx = 0;
+	for (const KeyValue<int, int> &E : const_map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == 3);
+}
+
+TEST_CASE("[GroupHashMap] Growth, erase and reuse of deleted slots") {
+	GroupHashMap<int, int> map;
+	const int count = 5000;
+
+	for (int i = 0; i < count; i++) {
+		map.insert(i, i * 2);
+	}
+	CHECK(map.size() == count);
+	CHECK(map.get_capacity() >= count);
+
+	int *value_ptr = map.getptr(1234);
+	REQUIRE(value_ptr != nullptr);
+
+	for (int i = 0; i < count; i += 2) {
+		CHECK(map.erase(i));
+	}
+	CHECK(map.size() == count / 2);
+
+	// Values must not move while the map is being modified.
+	CHECK(map.getptr(1234) == nullptr);
+	value_ptr = map.getptr(1235);
+	for (int round = 0; round < 8; round++) {
+		for (int i = count; i < count + 1000; i++) {
+			map.insert(i, i);
+		}
+		for (int i = count; i < count + 1000; i++) {
+			map.erase(i);
+		}
+	}
+	CHECK(map.getptr(1235) == value_ptr);
+	CHECK(map.size() == count / 2);
+
+	bool all_found = true;
+	for (int i = 0; i < count; i++) {
+		const int *v = map.getptr(i);
+		all_found = all_found && ((i % 2 == 0) ? v == nullptr : (v != nullptr && *v == i * 2));
+	}
+	CHECK(all_found);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(!map.has(1));
+	map[7] = 8;
+	CHECK(map.get(7) == 8);
+}
+
+TEST_CASE("[GroupHashMap] Replace key") {
+	GroupHashMap<String, int> map;
+	map.insert("a", 1);
+	map.insert("b", 2);
+	map.insert("c", 3);
+
+	CHECK(map.replace_key("b", "d"));
+	CHECK(!map.has("b"));
+	CHECK(map["d"] == 2);
+
+	Vector<String> expected = { "a", "d", "c" };
+	int idx = 0;
+	for (const KeyValue<String, int> &E : map) {
+		CHECK(E.key == expected[idx]);
+		++idx;
+	}
+}
+
+TEST_CASE("[GroupHashMap] Sort") {
+	GroupHashMap<int, int> map;
+	int shuffled_ints[]{ 6, 1, 9, 8, 3, 0, 4, 5, 7, 2 };
+
+	for (int i : shuffled_ints) {
+		map[i] = i;
+	}
+	map.sort();
+
+	int i = 0;
+	for (const KeyValue<int, int> &kv : map) {
+		CHECK_EQ(kv.key, i);
+		i++;
+	}
+}
+
+TEST_CASE("[GroupHashSet] Insert, erase and iteration") {
+	GroupHashSet<StringName> set{ "a", "b", "c" };
+	set.insert("b");
+	CHECK(set.size() == 3);
+	CHECK(set.has("c"));
+
+	CHECK(set.erase("a"));
+	CHECK(!set.has("a"));
+	CHECK(!set.find("a"));
+
+	Vector<StringName> expected = { "b", "c" };
+	int idx = 0;
+	for (const StringName &E : set) {
+		CHECK(E == expected[idx]);
+		++idx;
+	}
+	CHECK(idx == 2);
+}
+
+template <typename TMap>
+static void benchmark_map(const char *p_name, const Vector<StringName> &p_keys, const Vector<StringName> &p_missing) {
+	const int rounds = 20;
+	TMap map;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < p_keys.size(); i++) {
+		map.insert(p_keys[i], i);
+	}
+	const uint64_t insert_time = OS::get_singleton()->get_ticks_usec() - begin;
+
+	uint64_t found = 0;
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (const StringName &key : p_keys) {
+			found += map.getptr(key) != nullptr;
+		}
+	}
+	const uint64_t hit_time = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (const StringName &key : p_missing) {
+			found += map.getptr(key) != nullptr;
+		}
+	}
+	const uint64_t miss_time = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (const StringName &key : p_keys) {
+		map.erase(key);
+	}
+	const uint64_t erase_time = OS::get_singleton()->get_ticks_usec() - begin;
+
+	CHECK(found == uint64_t(rounds * p_keys.size()));
+	CHECK(map.is_empty());
+	MESSAGE(vformat("%s: insert %d us, lookup-hit %d us, lookup-miss %d us, erase %d us.", p_name, insert_time, hit_time, miss_time, erase_time));
+}
+
+// Insert, lookup and erase timings of the hash map implementations with StringName keys.
+TEST_CASE_BENCHMARK("[GroupHashMap][Benchmark] Compare with HashMap and AHashMap") {
+	const int count = 100000;
+	Vector<StringName> keys;
+	Vector<StringName> missing;
+	keys.resize(count);
+	missing.resize(count);
+	for (int i = 0; i < count; i++) {
+		keys.write[i] = StringName("key_" + itos(i));
+		missing.write[i] = StringName("missing_" + itos(i));
+	}
+
+	benchmark_map<HashMap<StringName, int>>("HashMap", keys, missing);
+	benchmark_map<AHashMap<StringName, int>>("AHashMap", keys, missing);
+	benchmark_map<GroupHashMap<StringName, int>>("GroupHashMap", keys, missing);
+}
+
+} // namespace TestGroupHashMap
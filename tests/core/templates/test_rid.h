@@ -251,6 +251,87 @@ TEST_CASE("[RID_Owner] Thread safety") {
 		tester.test();
 	}
 }
+
+TEST_CASE("[RID_Owner] Freeing from another thread reuses the elements") {
+	struct AllocatorState {
+		// Room for a few chunks only, so the test fails if freed elements are not reused.
+		RID_Owner<uint32_t, true> rid_owner = RID_Owner<uint32_t, true>(sizeof(uint32_t) * 16, 64);
+		LocalVector<RID> rids;
+	} state;
+
+	for (uint32_t round = 0; round < 32; round++) {
+		Thread thread;
+		thread.start(
+				[](void *p_data) {
+					AllocatorState *st = (AllocatorState *)p_data;
+					for (uint32_t i = 0; i < 48; i++) {
+						st->rids.push_back(st->rid_owner.make_rid(i));
+					}
+				},
+				&state);
+		thread.wait_to_finish();
+
+		CHECK_EQ(state.rid_owner.get_rid_count(), 48u);
+		for (uint32_t i = 0; i < state.rids.size(); i++) {
+			uint32_t *value = state.rid_owner.get_or_null(state.rids[i]);
+			REQUIRE(value != nullptr);
+			CHECK_EQ(*value, i);
+			state.rid_owner.free(state.rids[i]);
+			CHECK(state.rid_owner.get_or_null(state.rids[i]) == nullptr);
+		}
+		state.rids.clear();
+	}
+
+	CHECK_EQ(state.rid_owner.get_rid_count(), 0u);
+}
+
+// Allocating, looking up and freeing RIDs from several threads at once.
+TEST_CASE_BENCHMARK("[RID_Owner][Benchmark] Concurrent allocation, lookup and free") {
+	static constexpr uint32_t RID_COUNT = 4096;
+	static constexpr uint32_t ITERATIONS = 64;
+
+	struct BenchmarkState {
+		RID_Owner<uint64_t, true> rid_owner = RID_Owner<uint64_t, true>(65536, 1 << 20);
+		std::atomic<uint64_t> sum = 0;
+	} state;
+
+	for (uint32_t thread_count = 1; thread_count <= (uint32_t)OS::get_singleton()->get_processor_count(); thread_count *= 2) {
+		TightLocalVector<Thread> threads;
+		threads.resize(thread_count);
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (uint32_t i = 0; i < thread_count; i++) {
+			threads[i].start(
+					[](void *p_data) {
+						BenchmarkState *st = (BenchmarkState *)p_data;
+						LocalVector<RID> rids;
+						rids.resize(RID_COUNT);
+						uint64_t sum = 0;
+						for (uint32_t it = 0; it < ITERATIONS; it++) {
+							for (uint32_t j = 0; j < RID_COUNT; j++) {
+								rids[j] = st->rid_owner.make_rid(j);
+							}
+							for (uint32_t j = 0; j < RID_COUNT; j++) {
+								sum += *st->rid_owner.get_or_null(rids[j]);
+							}
+							for (uint32_t j = 0; j < RID_COUNT; j++) {
+								st->rid_owner.free(rids[j]);
+							}
+						}
+						st->sum.fetch_add(sum, std::memory_order_relaxed);
+					},
+					&state);
+		}
+		for (uint32_t i = 0; i < thread_count; i++) {
+			threads[i].wait_to_finish();
+		}
+		const uint64_t elapsed = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+		CHECK_EQ(state.sum.exchange(0), uint64_t(thread_count) * ITERATIONS * RID_COUNT * (RID_COUNT - 1) / 2);
+
+		const double operations_per_second = 3.0 * thread_count * RID_COUNT * ITERATIONS * 1000000.0 / elapsed;
+		MESSAGE(vformat("%d thread(s): %d us, %.1f M operations/s.", thread_count, elapsed, operations_per_second / 1000000.0));
+	}
+}
 #endif // THREADS_ENABLED
 
 } // namespace TestRID
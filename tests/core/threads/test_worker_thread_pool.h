@@ -106,6 +106,265 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static void static_leaf_task(void *p_arg) {
+	counter[(uint64_t)p_arg].increment();
+}
+
+static void static_spawning_task(void *p_arg) {
+	// Tasks posted from a pool thread go to its local queue, where idle threads can steal them.
+	const uint64_t base = (uint64_t)p_arg * 16;
+	WorkerThreadPool::TaskID subtasks[16];
+	for (uint64_t i = 0; i < 16; i++) {
+		subtasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_leaf_task, (void *)(base + i), i % 2);
+	}
+	for (uint64_t i = 0; i < 16; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(subtasks[i]);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Stress tasks spawned from pool threads") {
+	const int spawners = 64;
+	for (int iterations = 0; iterations < 20; iterations++) {
+		counter.clear();
+		counter.resize(spawners * 16);
+
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		tasks.resize(spawners);
+		for (int i = 0; i < spawners; i++) {
+			tasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_spawning_task, (void *)(uintptr_t)i, true);
+		}
+		for (int i = 0; i < spawners; i++) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+		}
+
+		bool all_run_once = true;
+		for (int i = 0; i < spawners * 16; i++) {
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
+static void static_uneven_group_test(void *p_arg, uint32_t p_index) {
+	// The first elements are much heavier, so tasks finishing early have to steal from the others.
+	if (p_index < 8) {
+		OS::get_singleton()->delay_usec(200);
+	}
+	counter[p_index].increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Process uneven group workloads through range stealing") {
+	for (int iterations = 0; iterations < 50; iterations++) {
+		const int count = 1000 + Math::rand() % 1000;
+		const int tasks = 1 + Math::rand() % 16;
+
+		counter.clear();
+		counter.resize(count);
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_uneven_group_test, nullptr, count, tasks, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		bool all_run_once = true;
+		for (int i = 0; i < count; i++) {
+			all_run_once &= counter[i].get() == 1;
+		}
+		CHECK(all_run_once);
+	}
+}
+
+static void static_empty_task(void *p_arg) {
+	counter[0].increment();
+}
+
+static void static_empty_group_test(void *p_arg, uint32_t p_index) {
+	counter[0].increment();
+}
+
+static void static_spawning_empty_tasks(void *p_arg) {
+	const int count = (int)(uintptr_t)p_arg;
+	LocalVector<WorkerThreadPool::TaskID> subtasks;
+	subtasks.resize(count);
+	for (int i = 0; i < count; i++) {
+		subtasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_empty_task, nullptr, true);
+	}
+	for (int i = 0; i < count; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(subtasks[i]);
+	}
+}
+
+// Scheduling overhead with every pool thread posting and running tiny tasks at once,
+// and with one group of tiny elements split across all threads.
+TEST_CASE_BENCHMARK("[WorkerThreadPool][Benchmark] Contention with tiny tasks") {
+	const int spawners = WorkerThreadPool::get_singleton()->get_thread_count() * 4;
+	const int tasks_per_spawner = 2000;
+	counter.clear();
+	counter.resize(1);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	LocalVector<WorkerThreadPool::TaskID> tasks;
+	tasks.resize(spawners);
+	for (int i = 0; i < spawners; i++) {
+		tasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_spawning_empty_tasks, (void *)(uintptr_t)tasks_per_spawner, true);
+	}
+	for (int i = 0; i < spawners; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+	}
+	const uint64_t task_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+	CHECK(counter[0].get() == spawners * tasks_per_spawner);
+
+	const int elements = 4000000;
+	counter[0].set(0);
+	begin = OS::get_singleton()->get_ticks_usec();
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_empty_group_test, nullptr, elements, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	const uint64_t group_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin, 1u);
+	CHECK(counter[0].get() == elements);
+
+	MESSAGE(vformat("%d threads: %d tasks/s posted from pool threads, %d group elements/s.",
+			WorkerThreadPool::get_singleton()->get_thread_count(),
+			int64_t(double(spawners) * tasks_per_spawner * 1000000.0 / task_usec),
+			int64_t(double(elements) * 1000000.0 / group_usec)));
+}
+
+static void static_stage_task(void *p_arg) {
+	// Each stage records its position in the execution order, and how much of the group had run by then.
+	counter[(uint64_t)p_arg].set(counter[0].increment());
+	counter[(uint64_t)p_arg + 6].set(counter[6].get());
+}
+
+static void static_stage_group_test(void *p_arg, uint32_t p_index) {
+	OS::get_singleton()->delay_usec(10);
+	counter[6].increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Run a graph of dependent tasks") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		counter.clear();
+		counter.resize(12);
+
+		// 1 and 2 are independent, 3 depends on both, the group (4) on 3 and 5 on the group.
+		WorkerThreadPool::TaskID stage1 = WorkerThreadPool::get_singleton()->add_native_task(static_stage_task, (void *)1, true);
+		WorkerThreadPool::TaskID stage2 = WorkerThreadPool::get_singleton()->add_native_task(static_stage_task, (void *)2);
+		WorkerThreadPool::TaskID deps3[] = { stage1, stage2 };
+		WorkerThreadPool::TaskID stage3 = WorkerThreadPool::get_singleton()->add_dependent_native_task(static_stage_task, (void *)3, deps3, true);
+		WorkerThreadPool::TaskID deps4[] = { stage3 };
+		WorkerThreadPool::TaskID stage4 = WorkerThreadPool::get_singleton()->add_dependent_native_task(static_stage_task, (void *)4, deps4);
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_stage_group_test, nullptr, 64, -1, true);
+		WorkerThreadPool::TaskID deps5[] = { stage4, group };
+		WorkerThreadPool::TaskID stage5 = WorkerThreadPool::get_singleton()->add_dependent_native_task(static_stage_task, (void *)5, deps5, true);
+
+		Vector<WorkerThreadPool::TaskID> graph = { stage1, stage2, stage3, stage4, group, stage5 };
+		CHECK(WorkerThreadPool::get_singleton()->wait_for_task_graph_completion(graph) == OK);
+
+		CHECK(counter[1].get() <= 2);
+		CHECK(counter[2].get() <= 2);
+		CHECK(counter[3].get() == 3);
+		CHECK(counter[4].get() == 4);
+		CHECK(counter[5].get() == 5);
+		CHECK(counter[11].get() == 64);
+	}
+}
+
+TEST_CASE("[WorkerThreadPool] Parallel for and reduce") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const uint32_t begin = Math::rand() % 100;
+		const uint32_t count = Math::rand() % 20000;
+		const uint32_t grain = 1 + Math::rand() % 64;
+
+		counter.clear();
+		counter.resize(begin + count);
+		WorkerThreadPool::parallel_for(begin, begin + count, grain, [](uint32_t p_index) {
+			counter[p_index].increment();
+		});
+
+		bool all_run_once = true;
+		for (uint32_t i = 0; i < begin + count; i++) {
+			all_run_once &= counter[i].get() == (i >= begin ? 1 : 0);
+		}
+		CHECK(all_run_once);
+
+		uint64_t sum = WorkerThreadPool::parallel_reduce(
+				begin, begin + count, grain, uint64_t(0),
+				[](uint32_t p_index, uint64_t &r_sum) {
+					r_sum += p_index;
+				},
+				[](uint64_t p_a, uint64_t p_b) {
+					return p_a + p_b;
+				});
+		CHECK(sum == (uint64_t(begin) * 2 + count - 1) * count / 2);
+	}
+}
+
+static void static_nested_parallel_for_task(void *p_arg) {
+	// Nested parallel loops on pool threads must not starve the pool.
+	WorkerThreadPool::parallel_for(0, 256, 1, [p_arg](uint32_t p_index) {
+		counter[(uint64_t)p_arg * 256 + p_index].increment();
+	});
+}
+
+TEST_CASE("[WorkerThreadPool] Parallel for from pool threads") {
+	const int tasks_count = WorkerThreadPool::get_singleton()->get_thread_count() * 2;
+	counter.clear();
+	counter.resize(tasks_count * 256);
+
+	LocalVector<WorkerThreadPool::TaskID> tasks;
+	for (int i = 0; i < tasks_count; i++) {
+		tasks.push_back(WorkerThreadPool::get_singleton()->add_native_task(static_nested_parallel_for_task, (void *)(uintptr_t)i, true));
+	}
+	for (WorkerThreadPool::TaskID task : tasks) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+	}
+
+	bool all_run_once = true;
+	for (int i = 0; i < tasks_count * 256; i++) {
+		all_run_once &= counter[i].get() == 1;
+	}
+	CHECK(all_run_once);
+}
+
+// A cheap per element body, so the result shows how much of the speedup the chunking overhead eats.
+TEST_CASE_BENCHMARK("[WorkerThreadPool][Benchmark] Parallel for against a serial loop") {
+	static constexpr uint32_t ELEMENT_COUNT = 1 << 20;
+	static constexpr uint32_t ITERATIONS = 50;
+
+	LocalVector<float> values;
+	values.resize(ELEMENT_COUNT);
+	float *ptr = values.ptr();
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (uint32_t it = 0; it < ITERATIONS; it++) {
+		for (uint32_t i = 0; i < ELEMENT_COUNT; i++) {
+			ptr[i] = Math::sqrt(float(i + it));
+		}
+	}
+	const uint64_t serial_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (uint32_t it = 0; it < ITERATIONS; it++) {
+		WorkerThreadPool::parallel_for(0, ELEMENT_COUNT, 1024, [ptr, it](uint32_t p_index) {
+			ptr[p_index] = Math::sqrt(float(p_index + it));
+		});
+	}
+	const uint64_t parallel_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	double sum = 0.0;
+	for (uint32_t it = 0; it < ITERATIONS; it++) {
+		sum = WorkerThreadPool::parallel_reduce(
+				0, ELEMENT_COUNT, 1024, 0.0,
+				[ptr](uint32_t p_index, double &r_sum) {
+					r_sum += ptr[p_index];
+				},
+				[](double p_a, double p_b) {
+					return p_a + p_b;
+				});
+	}
+	const uint64_t reduce_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%d threads: %d us serial, %d us with parallel_for(), %d us with parallel_reduce().",
+			WorkerThreadPool::get_singleton()->get_thread_count(), serial_usec, parallel_usec, reduce_usec));
+	CHECK(sum > 0.0);
+}
+
 static void static_test_daemon(void *p_arg) {
 	while (!exit.is_set()) {
 		counter[0].add(1);
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/os/thread.h"
 #include "core/variant/typed_dictionary.h"
 #include "tests/test_macros.h"
 
@@ -617,4 +618,62 @@ TEST_CASE("[Dictionary] RefCounted value init") {
 	CHECK_EQ(tdict[5.0], Variant(b));
 }
 
+TEST_CASE("[Dictionary] Pooled storage") {
+	{
+		Dictionary warm_up;
+		warm_up["key"] = 1;
+	}
+	const uint64_t hits = Memory::get_pool_hit_count();
+	const uint64_t misses = Memory::get_pool_miss_count();
+
+	for (int i = 0; i < 8; i++) {
+		Dictionary dict;
+		dict["key"] = i;
+		Array arr = { i };
+		dict["arr"] = arr;
+		CHECK(dict.size() == 2);
+		CHECK(int(Array(dict["arr"])[0]) == i);
+	}
+#ifdef DEBUG_ENABLED
+	// Every private struct and element was recycled from an earlier iteration.
+	CHECK(Memory::get_pool_hit_count() > hits);
+	CHECK(Memory::get_pool_miss_count() - misses <= 2);
+#endif
+
+	SUBCASE("Freed on another thread") {
+		Dictionary dict;
+		dict["key"] = Array({ 1, 2, 3 });
+		Thread thread;
+		thread.start([](void *p_userdata) {
+			Dictionary *d = static_cast<Dictionary *>(p_userdata);
+			CHECK(Array((*d)["key"]).size() == 3);
+			*d = Dictionary();
+		},
+				&dict);
+		thread.wait_to_finish();
+		CHECK(dict.is_empty());
+	}
+}
+
+// Creating and releasing small dictionaries, and how often the storage pool serves them.
+TEST_CASE_BENCHMARK("[Dictionary][Benchmark] Transient dictionaries") {
+	const int iterations = 1000000;
+	const uint64_t hits = Memory::get_pool_hit_count();
+	const uint64_t misses = Memory::get_pool_miss_count();
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	int64_t sum = 0;
+	for (int i = 0; i < iterations; i++) {
+		Dictionary payload;
+		payload["id"] = i;
+		payload["position"] = Vector2(i, i);
+		payload["args"] = Array({ i, i + 1 });
+		sum += payload.size();
+	}
+	const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(sum == int64_t(iterations) * 3);
+	const uint64_t pool_hits = Memory::get_pool_hit_count() - hits;
+	const uint64_t pool_total = pool_hits + Memory::get_pool_miss_count() - misses;
+	MESSAGE(vformat("%d dictionaries in %d usec, pool hit rate %.1f%%.", iterations, elapsed, pool_total ? 100.0 * pool_hits / pool_total : 0.0));
+}
+
 } // namespace TestDictionary
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/os/os.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
 
@@ -2245,4 +2246,42 @@ TEST_CASE("[Variant] Operator NOT") {
 	}
 }
 
+TEST_CASE("[Variant] Parser strings with escapes") {
+	VariantParser::StreamString ss;
+	String errs;
+	int line = 0;
+	Variant parsed;
+
+	// Long enough to outgrow the parser's inline string buffer.
+	const String long_text = String("x").repeat(300);
+	ss.s = "{ \"key\": \"a\\tb\\u00e9\", &\"name\": \"" + long_text + "\" }";
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+
+	const Dictionary dict = parsed;
+	CHECK(String(dict["key"]) == String::utf8("a\tb\xc3\xa9"));
+	CHECK(String(dict[StringName("name")]) == long_text);
+}
+
+// Parsing a large Variant text with many strings and string names.
+TEST_CASE_BENCHMARK("[Variant][Benchmark] Parser strings") {
+	const int count = 20000;
+	String text = "{\n";
+	for (int i = 0; i < count; i++) {
+		text += vformat("\"entity_%d\": [\"event\", \"node_%d\", &\"property_name\"],\n", i, i);
+	}
+	text += "}";
+
+	VariantParser::StreamString ss;
+	ss.s = text;
+	String errs;
+	int line = 0;
+	Variant parsed;
+	const uint64_t mem_before = Memory::get_mem_usage();
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	CHECK(VariantParser::parse(&ss, parsed, errs, line) == OK);
+	const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(Dictionary(parsed).size() == count);
+	MESSAGE(vformat("Parsed %d entries (%d characters) in %d usec, %d bytes retained.", count, text.length(), elapsed, Memory::get_mem_usage() - mem_before));
+}
+
 } // namespace TestVariant
@@ -30,6 +30,10 @@
 
 #pragma once
 
+#include "scene/gui/box_container.h"
+#include "scene/gui/button.h"
+#include "scene/gui/label.h"
+#include "scene/main/window.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -280,4 +284,37 @@ TEST_CASE("[PackedScene] Recreate State") {
 	memdelete(scene);
 }
 
+// Instantiating a scene whose containers connect to their children with method pointer callables.
+TEST_CASE_BENCHMARK("[SceneTree][PackedScene][Benchmark] Instantiate UI scene") {
+	// Rows of labels and buttons, whose containers connect to every child with method pointer callables.
+	VBoxContainer *root = memnew(VBoxContainer);
+	for (int i = 0; i < 500; i++) {
+		HBoxContainer *row = memnew(HBoxContainer);
+		root->add_child(row);
+		row->set_owner(root);
+		for (int j = 0; j < 4; j++) {
+			Label *label = memnew(Label);
+			label->set_text(vformat("Item %d", j));
+			row->add_child(label);
+			label->set_owner(root);
+			Button *button = memnew(Button);
+			row->add_child(button);
+			button->set_owner(root);
+		}
+	}
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	CHECK(packed_scene->pack(root) == OK);
+	memdelete(root);
+
+	const uint64_t mem_before = Memory::get_mem_usage();
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	Node *instance = packed_scene->instantiate();
+	SceneTree::get_singleton()->get_root()->add_child(instance);
+	const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+	CHECK(instance->get_child_count() == 500);
+	MESSAGE(vformat("Instantiated %d nodes in %d usec, %d bytes in use.", 500 * 9 + 1, elapsed, Memory::get_mem_usage() - mem_before));
+	memdelete(instance);
+}
+
 } // namespace TestPackedScene
@@ -914,6 +914,30 @@ TEST_CASE("[SceneTree][TabContainer] Mouse interaction") {
 	memdelete(tab_container);
 }
 
+TEST_CASE("[SceneTree][TabContainer] Repaints requested in the same frame are coalesced") {
+	TabContainer *tab_container = memnew(TabContainer);
+	SceneTree::get_singleton()->get_root()->add_child(tab_container);
+	MessageQueue::get_singleton()->flush();
+
+	const uint64_t coalesced_before = MessageQueue::get_singleton()->get_coalesced_message_count();
+
+	// Each toggle queues a deferred repaint; only the first one should be kept.
+	tab_container->set_tabs_visible(false);
+	tab_container->set_tabs_visible(true);
+	tab_container->set_tabs_visible(false);
+	tab_container->set_tabs_visible(true);
+	CHECK(MessageQueue::get_singleton()->get_coalesced_message_count() == coalesced_before + 3);
+
+	MessageQueue::get_singleton()->flush();
+
+	// Once flushed, a new request is queued again instead of being dropped.
+	tab_container->set_tabs_visible(false);
+	CHECK(MessageQueue::get_singleton()->get_coalesced_message_count() == coalesced_before + 3);
+	MessageQueue::get_singleton()->flush();
+
+	memdelete(tab_container);
+}
+
 // FIXME: Add tests for keyboard navigation and other methods.
 
 } // namespace TestTabContainer
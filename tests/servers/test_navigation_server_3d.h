@@ -30,6 +30,9 @@
 
 #pragma once
 
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "modules/navigation_3d/3d/nav_mesh_generator_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "servers/navigation_server_3d.h"
@@ -50,6 +53,43 @@ public:
 	Variant function1_latest_arg0;
 };
 
+// Grid of 1x1 quads with a wall at `x == p_size / 2` that is only open at the far end,
+// so paths between both halves have to take a detour.
+static Ref<NavigationMesh> create_walled_grid_navigation_mesh(int p_size) {
+	Vector<Vector3> vertices;
+	for (int z = 0; z <= p_size; z++) {
+		for (int x = 0; x <= p_size; x++) {
+			vertices.push_back(Vector3(x, 0, z));
+		}
+	}
+
+	Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+	navigation_mesh->set_vertices(vertices);
+	for (int z = 0; z < p_size; z++) {
+		for (int x = 0; x < p_size; x++) {
+			if (x == p_size / 2 && z < p_size - 4) {
+				continue;
+			}
+			const int index = z * (p_size + 1) + x;
+			Vector<int> polygon;
+			polygon.push_back(index);
+			polygon.push_back(index + 1);
+			polygon.push_back(index + p_size + 2);
+			polygon.push_back(index + p_size + 1);
+			navigation_mesh->add_polygon(polygon);
+		}
+	}
+	return navigation_mesh;
+}
+
+static real_t get_path_length(const Vector<Vector3> &p_path) {
+	real_t length = 0.0;
+	for (int i = 1; i < p_path.size(); i++) {
+		length += p_path[i - 1].distance_to(p_path[i]);
+	}
+	return length;
+}
+
 TEST_SUITE("[Navigation3D]") {
 	TEST_CASE("[NavigationServer3D] Server should be empty when initialized") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
@@ -665,6 +705,247 @@ TEST_SUITE("[Navigation3D]") {
 		memdelete(node_3d);
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should bake navigation mesh in tiles") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(4.0);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(10.0, 0.001, 10.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+		CHECK_NE(navigation_mesh->get_vertices().size(), 0);
+
+		SUBCASE("Rebaking unchanged source geometry should produce the same navigation mesh") {
+			Vector<Vector3> vertices = navigation_mesh->get_vertices();
+			int polygon_count = navigation_mesh->get_polygon_count();
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_EQ(navigation_mesh->get_vertices(), vertices);
+			CHECK_EQ(navigation_mesh->get_polygon_count(), polygon_count);
+		}
+
+		SUBCASE("Changing source geometry in one tile should only rebake that tile") {
+			const uint32_t baked_tile_count = NavMeshGenerator3D::get_baked_tile_count();
+			Array box_arr;
+			box_arr.resize(RS::ARRAY_MAX);
+			BoxMesh::create_mesh_array(box_arr, Vector3(0.5, 0.5, 0.5));
+			// Far enough from the tile borders that the padding of the neighboring tiles doesn't reach it.
+			source_geometry->add_mesh_array(box_arr, Transform3D(Basis(), Vector3(2.0, 0.25, 2.0)));
+			navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+			CHECK_EQ(NavMeshGenerator3D::get_baked_tile_count() - baked_tile_count, 1u);
+
+			Ref<NavigationMesh> fresh_navigation_mesh = memnew(NavigationMesh);
+			fresh_navigation_mesh->set_tile_size(4.0);
+			navigation_server->bake_from_source_geometry_data(fresh_navigation_mesh, source_geometry, Callable());
+			CHECK_GT(NavMeshGenerator3D::get_baked_tile_count() - baked_tile_count, 1u);
+			CHECK_EQ(navigation_mesh->get_vertices(), fresh_navigation_mesh->get_vertices());
+			REQUIRE_EQ(navigation_mesh->get_polygon_count(), fresh_navigation_mesh->get_polygon_count());
+			for (int i = 0; i < navigation_mesh->get_polygon_count(); i++) {
+				CHECK_EQ(navigation_mesh->get_polygon(i), fresh_navigation_mesh->get_polygon(i));
+			}
+		}
+
+		SUBCASE("Tiled navigation mesh should be connected across tile borders") {
+			RID map = navigation_server->map_create();
+			RID region = navigation_server->region_create();
+			navigation_server->map_set_active(map, true);
+			navigation_server->map_set_use_async_iterations(map, false);
+			navigation_server->region_set_use_async_iterations(region, false);
+			navigation_server->region_set_map(region, map);
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-4, 0, -4), Vector3(4, 0, 4), true);
+			REQUIRE_NE(path.size(), 0);
+			CHECK(path[path.size() - 1].distance_to(Vector3(4, 0, 4)) < 0.5);
+
+			navigation_server->free(region);
+			navigation_server->free(map);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		}
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should find paths with hierarchical pathfinding") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		// Small clusters so that the test navigation mesh is split into many of them.
+		navigation_server->map_set_hierarchical_cluster_size(map, 4.0);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, create_walled_grid_navigation_mesh(32));
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+		query_parameters->set_map(map);
+		query_parameters->set_start_position(Vector3(2.5, 0, 2.5));
+		query_parameters->set_target_position(Vector3(29.5, 0, 2.5));
+		query_parameters->set_path_search_max_polygons(0);
+
+		Ref<NavigationPathQueryResult3D> astar_result = memnew(NavigationPathQueryResult3D);
+		navigation_server->query_path(query_parameters, astar_result);
+		REQUIRE_NE(astar_result->get_path().size(), 0);
+
+		query_parameters->set_pathfinding_algorithm(NavigationPathQueryParameters3D::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR);
+
+		SUBCASE("Hierarchical path should reach the target around the wall") {
+			Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, query_result);
+			const Vector<Vector3> path = query_result->get_path();
+			REQUIRE_NE(path.size(), 0);
+			CHECK(path[path.size() - 1].is_equal_approx(Vector3(29.5, 0, 2.5)));
+			CHECK_GT(get_path_length(path), 50.0);
+			CHECK_LE(get_path_length(path), get_path_length(astar_result->get_path()) * 1.25);
+		}
+
+		SUBCASE("Hierarchical query with non-matching navigation layer mask should yield empty result") {
+			query_parameters->set_navigation_layers(2);
+			Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, query_result);
+			CHECK_EQ(query_result->get_path().size(), 0);
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Hierarchical pathfinding should fall back when the cluster route is blocked") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->map_set_hierarchical_cluster_size(map, 4.0);
+
+		RID region = navigation_server->region_create();
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, create_walled_grid_navigation_mesh(32));
+
+		// A second gap in the wall right between start and target. The cluster graph ignores navigation
+		// layers, so its route leads through this gap, while the only gap usable with layer 1 is far outside of it.
+		Ref<NavigationMesh> gap_navigation_mesh = memnew(NavigationMesh);
+		Vector<Vector3> gap_vertices;
+		for (int z = 0; z <= 4; z++) {
+			gap_vertices.push_back(Vector3(16, 0, z));
+			gap_vertices.push_back(Vector3(17, 0, z));
+		}
+		gap_navigation_mesh->set_vertices(gap_vertices);
+		for (int z = 0; z < 4; z++) {
+			Vector<int> polygon;
+			polygon.push_back(z * 2);
+			polygon.push_back(z * 2 + 1);
+			polygon.push_back(z * 2 + 3);
+			polygon.push_back(z * 2 + 2);
+			gap_navigation_mesh->add_polygon(polygon);
+		}
+		RID gap_region = navigation_server->region_create();
+		navigation_server->region_set_use_async_iterations(gap_region, false);
+		navigation_server->region_set_navigation_layers(gap_region, 2);
+		navigation_server->region_set_map(gap_region, map);
+		navigation_server->region_set_navigation_mesh(gap_region, gap_navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+		query_parameters->set_map(map);
+		query_parameters->set_start_position(Vector3(2.5, 0, 2.5));
+		query_parameters->set_target_position(Vector3(29.5, 0, 2.5));
+		query_parameters->set_path_search_max_polygons(0);
+		query_parameters->set_pathfinding_algorithm(NavigationPathQueryParameters3D::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR);
+
+		SUBCASE("Hierarchical path should use the gap inside the cluster route when its layer is included") {
+			query_parameters->set_navigation_layers(1 | 2);
+			Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, query_result);
+			const Vector<Vector3> path = query_result->get_path();
+			REQUIRE_NE(path.size(), 0);
+			CHECK(path[path.size() - 1].is_equal_approx(Vector3(29.5, 0, 2.5)));
+			CHECK_LT(get_path_length(path), 30.0);
+		}
+
+		SUBCASE("Hierarchical path should take the detour outside the cluster route when its gap is excluded") {
+			query_parameters->set_navigation_layers(1);
+			Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, query_result);
+			const Vector<Vector3> path = query_result->get_path();
+			REQUIRE_NE(path.size(), 0);
+			CHECK(path[path.size() - 1].is_equal_approx(Vector3(29.5, 0, 2.5)));
+			CHECK_GT(get_path_length(path), 50.0);
+
+			query_parameters->set_pathfinding_algorithm(NavigationPathQueryParameters3D::PATHFINDING_ALGORITHM_ASTAR);
+			Ref<NavigationPathQueryResult3D> astar_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, astar_result);
+			CHECK_EQ(get_path_length(path), doctest::Approx(get_path_length(astar_result->get_path())));
+		}
+
+		navigation_server->free(gap_region);
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	// Latency and path length of long queries with A* and hierarchical A*, and the memory of both map synchronizations.
+	TEST_CASE_BENCHMARK("[NavigationServer3D][Benchmark] Long path queries with hierarchical pathfinding") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = create_walled_grid_navigation_mesh(512);
+
+		// One map without and one with the cluster graph, to compare the memory used by the map synchronization.
+		RID maps[2];
+		RID regions[2];
+		uint64_t sync_memory[2];
+		for (int i = 0; i < 2; i++) {
+			maps[i] = navigation_server->map_create();
+			regions[i] = navigation_server->region_create();
+			navigation_server->map_set_active(maps[i], true);
+			navigation_server->map_set_hierarchical_cluster_size(maps[i], i == 0 ? 0.0 : 16.0);
+			navigation_server->map_set_use_async_iterations(maps[i], false);
+			navigation_server->region_set_use_async_iterations(regions[i], false);
+			navigation_server->region_set_map(regions[i], maps[i]);
+			navigation_server->region_set_navigation_mesh(regions[i], navigation_mesh);
+
+			const uint64_t memory_before = Memory::get_mem_usage();
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			sync_memory[i] = Memory::get_mem_usage() - memory_before;
+		}
+
+		Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+		query_parameters->set_path_search_max_polygons(0);
+		Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+
+		// Paths between random points of both halves of the grid.
+		const int count = 50;
+		RandomPCG rng(1234);
+		uint64_t usec[2] = {};
+		real_t length[2] = {};
+		for (int i = 0; i < count; i++) {
+			query_parameters->set_start_position(Vector3(rng.randf() * 250.0, 0, rng.randf() * 512.0));
+			query_parameters->set_target_position(Vector3(262.0 + rng.randf() * 250.0, 0, rng.randf() * 512.0));
+
+			for (int j = 0; j < 2; j++) {
+				query_parameters->set_map(maps[j]);
+				query_parameters->set_pathfinding_algorithm(j == 0 ? NavigationPathQueryParameters3D::PATHFINDING_ALGORITHM_ASTAR : NavigationPathQueryParameters3D::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR);
+				const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+				navigation_server->query_path(query_parameters, query_result);
+				usec[j] += OS::get_singleton()->get_ticks_usec() - begin;
+				length[j] += get_path_length(query_result->get_path());
+			}
+		}
+
+		MESSAGE(vformat("%d polygons, %d queries: A* %d usec, %.1f m, %d bytes synced; hierarchical A* %d usec, %.1f m, %d bytes synced.", navigation_mesh->get_polygon_count(), count, usec[0], length[0], sync_memory[0], usec[1], length[1], sync_memory[1]));
+
+		for (int i = 0; i < 2; i++) {
+			navigation_server->free(regions[i]);
+			navigation_server->free(maps[i]);
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
 	// This test case does not check precise values on purpose - to not be too sensitivte.
 	TEST_CASE("[NavigationServer3D] Server should respond to queries against valid map properly") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
@@ -0,0 +1,322 @@
+/**************************************************************************/
+/*  test_physics_server_3d.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "core/math/random_pcg.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "servers/physics_server_3d.h"
+#include "servers/physics_server_3d_dummy.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer3D {
+
+// Lays out a grid of static unit boxes on the XZ plane, 2 units apart.
+static void create_box_grid(PhysicsServer3D *p_server, RID p_space, RID p_shape, int p_size, LocalVector<RID> &r_bodies) {
+	for (int x = 0; x < p_size; x++) {
+		for (int z = 0; z < p_size; z++) {
+			RID body = p_server->body_create();
+			p_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+			p_server->body_add_shape(body, p_shape);
+			p_server->body_set_space(body, p_space);
+			p_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(x * 2, 0, z * 2)));
+			r_bodies.push_back(body);
+		}
+	}
+}
+
+static void free_rids(PhysicsServer3D *p_server, const LocalVector<RID> &p_rids) {
+	for (const RID &rid : p_rids) {
+		p_server->free(rid);
+	}
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Batched queries match single queries") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+	RID space = physics_server->space_create();
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(0.5, 0.5, 0.5));
+
+	LocalVector<RID> bodies;
+	create_box_grid(physics_server, space, shape, 4, bodies);
+
+	PhysicsDirectSpaceState3D *space_state = physics_server->space_get_direct_state(space);
+	REQUIRE(space_state != nullptr);
+
+	// More queries than fit in one chunk, so that backends take their parallel path.
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	for (int x = 0; x < 20; x++) {
+		for (int z = 0; z < 20; z++) {
+			const Vector3 origin = Vector3(-1.0 + x * 0.5, 5.0, -1.0 + z * 0.5);
+			from.push_back(origin);
+			to.push_back(origin + Vector3(0, -10, 0));
+		}
+	}
+	const int count = from.size();
+
+	SUBCASE("intersect_ray_batch") {
+		PhysicsDirectSpaceState3D::RayParameters parameters;
+		LocalVector<PhysicsDirectSpaceState3D::RayResult> results;
+		results.resize(count);
+		LocalVector<bool> hits;
+		hits.resize(count);
+		space_state->intersect_ray_batch(parameters, from.ptr(), to.ptr(), count, results.ptr(), hits.ptr());
+
+		int hit_count = 0;
+		for (int i = 0; i < count; i++) {
+			parameters.from = from[i];
+			parameters.to = to[i];
+			PhysicsDirectSpaceState3D::RayResult result;
+			const bool hit = space_state->intersect_ray(parameters, result);
+			CHECK_MESSAGE(hits[i] == hit, vformat("Ray %d should give the same result in a batch.", i));
+			if (hit && hits[i]) {
+				CHECK(results[i].position.is_equal_approx(result.position));
+				CHECK(results[i].normal.is_equal_approx(result.normal));
+				CHECK(results[i].rid == result.rid);
+				CHECK(results[i].shape == result.shape);
+				hit_count++;
+			}
+		}
+		CHECK_MESSAGE(hit_count > 0, "Some rays should hit the boxes.");
+		CHECK_MESSAGE(hit_count < count, "Some rays should fall between the boxes.");
+	}
+
+	SUBCASE("cast_motion_batch") {
+		RID sphere = physics_server->sphere_shape_create();
+		physics_server->shape_set_data(sphere, 0.25);
+
+		PhysicsDirectSpaceState3D::ShapeParameters parameters;
+		parameters.shape_rid = sphere;
+		LocalVector<Vector3> motions;
+		for (int i = 0; i < count; i++) {
+			motions.push_back(to[i] - from[i]);
+		}
+		LocalVector<real_t> closest_safe;
+		closest_safe.resize(count);
+		LocalVector<real_t> closest_unsafe;
+		closest_unsafe.resize(count);
+		space_state->cast_motion_batch(parameters, from.ptr(), motions.ptr(), count, closest_safe.ptr(), closest_unsafe.ptr());
+
+		int hit_count = 0;
+		for (int i = 0; i < count; i++) {
+			parameters.transform.origin = from[i];
+			parameters.motion = motions[i];
+			real_t safe = 1.0;
+			real_t unsafe = 1.0;
+			space_state->cast_motion(parameters, safe, unsafe);
+			CHECK(Math::is_equal_approx(closest_safe[i], safe));
+			CHECK(Math::is_equal_approx(closest_unsafe[i], unsafe));
+			if (safe < 1.0) {
+				hit_count++;
+			}
+		}
+		CHECK_MESSAGE(hit_count > 0, "Some shapes should hit the boxes.");
+
+		physics_server->free(sphere);
+	}
+
+	free_rids(physics_server, bodies);
+	physics_server->free(shape);
+	physics_server->free(space);
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Space state hash follows body state") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+	RID space = physics_server->space_create();
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(0.5, 0.5, 0.5));
+
+	LocalVector<RID> bodies;
+	create_box_grid(physics_server, space, shape, 2, bodies);
+
+	const uint64_t hash = physics_server->space_get_state_hash(space);
+	if (Object::cast_to<PhysicsServer3DDummy>(physics_server)) {
+		CHECK(hash == 0);
+	} else {
+		REQUIRE_MESSAGE(hash != 0, "Physics servers other than the dummy one should implement the state hash.");
+		CHECK_MESSAGE(physics_server->space_get_state_hash(space) == hash, "The hash should only depend on the state of the bodies.");
+
+		const Transform3D transform = physics_server->body_get_state(bodies[0], PhysicsServer3D::BODY_STATE_TRANSFORM);
+		physics_server->body_set_state(bodies[0], PhysicsServer3D::BODY_STATE_TRANSFORM, transform.translated(Vector3(0, 1, 0)));
+		CHECK_MESSAGE(physics_server->space_get_state_hash(space) != hash, "Moving a body should change the hash.");
+
+		physics_server->body_set_state(bodies[0], PhysicsServer3D::BODY_STATE_TRANSFORM, transform);
+		CHECK_MESSAGE(physics_server->space_get_state_hash(space) == hash, "Moving the body back should restore the hash.");
+	}
+
+	free_rids(physics_server, bodies);
+	physics_server->free(shape);
+	physics_server->free(space);
+}
+
+// Drops a few piles of boxes on a floor in a new space, and returns the state hash after a second of simulation.
+static uint64_t simulate_box_piles(PhysicsServer3D *p_server) {
+	RID space = p_server->space_create();
+	p_server->space_set_active(space, true);
+	p_server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 9.8);
+	p_server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY_VECTOR, Vector3(0, -1, 0));
+
+	RID floor_shape = p_server->world_boundary_shape_create();
+	p_server->shape_set_data(floor_shape, Plane(Vector3(0, 1, 0), 0));
+	RID box_shape = p_server->box_shape_create();
+	p_server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	LocalVector<RID> bodies;
+	RID floor = p_server->body_create();
+	p_server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	p_server->body_add_shape(floor, floor_shape);
+	p_server->body_set_space(floor, space);
+	bodies.push_back(floor);
+
+	// Piles far enough apart to be separate islands, with slightly tilted boxes so they topple.
+	for (int pile = 0; pile < 8; pile++) {
+		for (int level = 0; level < 6; level++) {
+			RID body = p_server->body_create();
+			p_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+			p_server->body_add_shape(body, box_shape);
+			p_server->body_set_space(body, space);
+			const Basis basis(Vector3(pile, 1, level).normalized(), 0.05 * (level + 1));
+			p_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(basis, Vector3(pile * 4, 0.5 + level * 1.1, (pile % 3) * 0.2)));
+			bodies.push_back(body);
+		}
+	}
+
+	for (int i = 0; i < 60; i++) {
+		p_server->step(1.0 / 60.0);
+	}
+	const uint64_t hash = p_server->space_get_state_hash(space);
+
+	free_rids(p_server, bodies);
+	p_server->free(box_shape);
+	p_server->free(floor_shape);
+	p_server->free(space);
+	return hash;
+}
+
+static SafeFlag release_blocked_threads;
+static SafeNumeric<int> blocked_threads;
+
+static void block_thread(void *p_arg) {
+	blocked_threads.increment();
+	while (!release_blocked_threads.is_set()) {
+		OS::get_singleton()->delay_usec(100);
+	}
+}
+
+TEST_CASE("[SceneTree][PhysicsServer3D] Deterministic solving is reproducible") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+	if (Object::cast_to<PhysicsServer3DDummy>(physics_server)) {
+		return; // Nothing is simulated.
+	}
+
+	// The setting is read when spaces are created.
+	ProjectSettings::get_singleton()->set_setting("physics/3d/solver/deterministic", true);
+
+	const uint64_t hash = simulate_box_piles(physics_server);
+	CHECK(hash != 0);
+	CHECK_MESSAGE(simulate_box_piles(physics_server) == hash, "Running the same simulation again should give the same state.");
+
+	// Keep all pool threads but one busy, so the parallel steps of the solver all run on a single thread.
+	const int thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+	if (thread_count > 1) {
+		release_blocked_threads.clear();
+		blocked_threads.set(0);
+		LocalVector<WorkerThreadPool::TaskID> blockers;
+		for (int i = 0; i < thread_count - 1; i++) {
+			blockers.push_back(WorkerThreadPool::get_singleton()->add_native_task(block_thread, nullptr, true));
+		}
+		while (blocked_threads.get() < thread_count - 1) {
+			OS::get_singleton()->delay_usec(100);
+		}
+
+		CHECK_MESSAGE(simulate_box_piles(physics_server) == hash, "The number of threads solving should not change the state.");
+
+		release_blocked_threads.set();
+		for (WorkerThreadPool::TaskID blocker : blockers) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(blocker);
+		}
+	}
+
+	ProjectSettings::get_singleton()->set_setting("physics/3d/solver/deterministic", false);
+}
+
+// Many line of sight rays cast with `intersect_ray` one by one and with `intersect_ray_batch`.
+TEST_CASE_BENCHMARK("[SceneTree][PhysicsServer3D][Benchmark] Batched ray queries") {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+	RID space = physics_server->space_create();
+	RID shape = physics_server->box_shape_create();
+	physics_server->shape_set_data(shape, Vector3(0.5, 0.5, 0.5));
+
+	LocalVector<RID> bodies;
+	create_box_grid(physics_server, space, shape, 32, bodies);
+
+	PhysicsDirectSpaceState3D *space_state = physics_server->space_get_direct_state(space);
+	REQUIRE(space_state != nullptr);
+
+	// Line of sight rays between random points above the grid.
+	const int count = 50000;
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	RandomPCG rng(1234);
+	for (int i = 0; i < count; i++) {
+		from.push_back(Vector3(rng.randf() * 64.0, 0.25 + rng.randf(), rng.randf() * 64.0));
+		to.push_back(Vector3(rng.randf() * 64.0, 0.25 + rng.randf(), rng.randf() * 64.0));
+	}
+
+	PhysicsDirectSpaceState3D::RayParameters parameters;
+	LocalVector<PhysicsDirectSpaceState3D::RayResult> results;
+	results.resize(count);
+	LocalVector<bool> hits;
+	hits.resize(count);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < count; i++) {
+		parameters.from = from[i];
+		parameters.to = to[i];
+		hits[i] = space_state->intersect_ray(parameters, results[i]);
+	}
+	const uint64_t loop_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	space_state->intersect_ray_batch(parameters, from.ptr(), to.ptr(), count, results.ptr(), hits.ptr());
+	const uint64_t batch_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%d rays: %d usec with intersect_ray, %d usec with intersect_ray_batch.", count, loop_usec, batch_usec));
+
+	free_rids(physics_server, bodies);
+	physics_server->free(shape);
+	physics_server->free(space);
+}
+
+} // namespace TestPhysicsServer3D